@@ -537,10 +537,11 @@ int main(int argc, char* argv[])
              << "                  0. DROP_TABLE\n"
              << "                  1. DELETE_NODE_GROUP\n"
              << "                  2. ALTER_TABLE\n"
-             << "               If strategy is seed, value can be any integer."
-	     << "NOTE: If you want to disable FreeChunkMap, update ENABLE_FREE_CHUNK_MAP accordingly."
-	     << "      Always clean old build by make -sj clean if ENABLE_FREE_CHUNK_MAP is updated."
-	     << endl;
+             << "               If strategy is seed, value can be any integer.\n"
+             << "    -P <policy> Optional free chunk policy of the new database, one of\n"
+             << "               append_only | first_fit | best_fit (default best_fit).\n"
+             << "               Use append_only to run without FreeChunkMap."
+             << endl;
         return 0;
     }
 
@@ -599,6 +600,25 @@ int main(int argc, char* argv[])
         }
     }
 
+    /* Free chunk policy is only applied when the database is created, see SystemConfig */
+    string policyStr = "best_fit";
+    char* policyArg = GetCmdOption(argv, argv + argc, "-P");
+    if (policyArg != nullptr) {
+        policyStr = policyArg;
+    }
+    kuzu::common::FreeChunkPolicy policy;
+    if (policyStr == "append_only") {
+        policy = kuzu::common::FreeChunkPolicy::APPEND_ONLY;
+    } else if (policyStr == "first_fit") {
+        policy = kuzu::common::FreeChunkPolicy::FIRST_FIT;
+    } else if (policyStr == "best_fit") {
+        policy = kuzu::common::FreeChunkPolicy::BEST_FIT;
+    } else {
+        cout << policyStr << " is not a valid free chunk policy" << endl
+             << "Please use -h option to see what parameter we need" << endl;
+        return 0;
+    }
+
     databaseHomeDirectory = databaseDir;
     dataFilePath = databaseHomeDirectory + "/data.kz";
     metadataFilePath = databaseHomeDirectory + "/metadata.kz";
@@ -609,6 +629,7 @@ int main(int argc, char* argv[])
         <<"    Database home directory: "<<databaseDir<<endl
         <<"    Test strategy: "<<strategyStr<<endl
         <<"    Strategy value: "<<value<<endl
+        <<"    Free chunk policy: "<<policyStr<<endl
         <<"    Debug Build?: "
 #ifdef DEBUG
         <<"True"
@@ -629,6 +650,7 @@ int main(int argc, char* argv[])
 
     /* Create an empty on-disk database and connect to it */
     kuzu::main::SystemConfig systemConfig;
+    systemConfig.freeChunkPolicy = policy;
     auto database = make_unique<Database>(databaseDir, systemConfig);
     auto connection = make_unique<Connection>(database.get());
 
@@ -667,9 +689,11 @@ int main(int argc, char* argv[])
         }
 
         TestCaseStat::PrintAllStat(allStat);
+        /* Allocator counters of this run, e.g. pages reused vs. appended under the chosen policy */
+        cout << connection->query("CALL free_chunk_info() RETURN *;")->toString() << endl;
 
         ostringstream oss;
-        oss << strategy << "_" << value << "_result.csv";
+        oss << strategy << "_" << value << "_" << policyStr << "_result.csv";
         TestCaseStat::publishCsv(allStat, oss.str());
     }
 }
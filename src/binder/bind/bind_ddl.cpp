@@ -6,6 +6,7 @@
 #include "binder/ddl/bound_drop.h"
 #include "binder/expression/expression_util.h"
 #include "catalog/catalog.h"
+#include "catalog/catalog_entry/index_catalog_entry.h"
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
 #include "catalog/catalog_entry/rdf_graph_catalog_entry.h"
 #include "catalog/catalog_entry/rel_group_catalog_entry.h"
@@ -452,6 +453,19 @@ static void validatePropertyNotExist(TableCatalogEntry* tableEntry,
     }
 }
 
+static void validatePropertyNotIndexed(main::ClientContext* context,
+    TableCatalogEntry* tableEntry, const std::string& propertyName,
+    const std::string& ddlOperation) {
+    for (auto& indexEntry :
+        context->getCatalog()->getIndexEntries(context->getTx(), tableEntry->getTableID())) {
+        if (indexEntry->getPropertyName() == propertyName) {
+            throw BinderException(stringFormat("Cannot {} property {} of table {} because it is "
+                                               "indexed by {}. Drop the index first.",
+                ddlOperation, propertyName, tableEntry->getName(), indexEntry->getName()));
+        }
+    }
+}
+
 static void validatePropertyDDLOnTable(TableCatalogEntry* tableEntry,
     const std::string& ddlOperation) {
     switch (tableEntry->getTableType()) {
@@ -523,6 +537,7 @@ std::unique_ptr<BoundStatement> Binder::bindDropProperty(const Statement& statem
         tableEntry->constCast<NodeTableCatalogEntry>().getPrimaryKeyName() == propertyName) {
         throw BinderException("Cannot drop primary key of a node table.");
     }
+    validatePropertyNotIndexed(clientContext, tableEntry, propertyName, "drop");
     auto boundExtraInfo = std::make_unique<BoundExtraDropPropertyInfo>(propertyName);
     auto boundInfo = BoundAlterInfo(AlterType::DROP_PROPERTY, tableName, std::move(boundExtraInfo));
     return std::make_unique<BoundAlter>(std::move(boundInfo));
@@ -541,6 +556,7 @@ std::unique_ptr<BoundStatement> Binder::bindRenameProperty(const Statement& stat
     validatePropertyDDLOnTable(tableSchema, "rename");
     validatePropertyExist(tableSchema, propertyName);
     validatePropertyNotExist(tableSchema, newName);
+    validatePropertyNotIndexed(clientContext, tableSchema, propertyName, "rename");
     auto boundExtraInfo = std::make_unique<BoundExtraRenamePropertyInfo>(newName, propertyName);
     auto boundInfo =
         BoundAlterInfo(AlterType::RENAME_PROPERTY, tableName, std::move(boundExtraInfo));
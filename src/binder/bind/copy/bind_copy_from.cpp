@@ -1,5 +1,6 @@
 #include "binder/binder.h"
 #include "binder/copy/bound_copy_from.h"
+#include "binder/expression/literal_expression.h"
 #include "catalog/catalog.h"
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
 #include "catalog/catalog_entry/rdf_graph_catalog_entry.h"
@@ -7,6 +8,7 @@
 #include "common/enums/table_type.h"
 #include "common/exception/binder.h"
 #include "common/string_format.h"
+#include "common/string_utils.h"
 #include "main/client_context.h"
 #include "parser/copy.h"
 
@@ -85,8 +87,40 @@ std::unique_ptr<BoundStatement> Binder::bindCopyNodeFrom(const Statement& statem
     std::vector<LogicalType> expectedColumnTypes;
     bindExpectedNodeColumns(nodeTableEntry, copyStatement.getColumnNames(), expectedColumnNames,
         expectedColumnTypes);
-    auto boundSource = bindScanSource(copyStatement.getSource(),
-        copyStatement.getParsingOptionsRef(), expectedColumnNames, expectedColumnTypes);
+    // CLUSTER_BY is handled by the copy itself, so it is not passed on to the scan function.
+    options_t scanOptions;
+    std::string clusterByColumnName;
+    for (auto& [name, option] : copyStatement.getParsingOptionsRef()) {
+        if (StringUtils::getUpper(name) != CopyConstants::CLUSTER_BY_OPTION_NAME) {
+            scanOptions.insert({name, option->copy()});
+            continue;
+        }
+        auto expr = expressionBinder.bindExpression(*option);
+        if (expr->expressionType != ExpressionType::LITERAL ||
+            expr->getDataType().getLogicalTypeID() != LogicalTypeID::STRING) {
+            throw BinderException(stringFormat("{} option must be a string literal.",
+                CopyConstants::CLUSTER_BY_OPTION_NAME));
+        }
+        clusterByColumnName =
+            expr->constCast<LiteralExpression>().getValue().getValue<std::string>();
+    }
+    auto boundSource = bindScanSource(copyStatement.getSource(), scanOptions,
+        expectedColumnNames, expectedColumnTypes);
+    std::unique_ptr<ExtraBoundCopyFromInfo> extraInfo;
+    if (!clusterByColumnName.empty()) {
+        std::shared_ptr<Expression> clusterKey;
+        for (auto& column : boundSource->getColumns()) {
+            if (StringUtils::caseInsensitiveEquals(column->toString(), clusterByColumnName)) {
+                clusterKey = column;
+            }
+        }
+        if (clusterKey == nullptr) {
+            throw BinderException(stringFormat("Cannot cluster by {}: it is not a column of the "
+                                               "copy source.",
+                clusterByColumnName));
+        }
+        extraInfo = std::make_unique<ExtraBoundCopyNodeInfo>(std::move(clusterKey));
+    }
     expression_vector warningDataExprs = boundSource->getWarningColumns();
     if (boundSource->type == ScanSourceType::FILE) {
         auto& source = boundSource->constCast<BoundTableScanSource>();
@@ -109,7 +143,7 @@ std::unique_ptr<BoundStatement> Binder::bindCopyNodeFrom(const Statement& statem
     auto offset = expressionBinder.createVariableExpression(LogicalType::INT64(),
         std::string(InternalKeyword::ANONYMOUS));
     auto boundCopyFromInfo = BoundCopyFromInfo(nodeTableEntry, std::move(boundSource),
-        std::move(offset), std::move(columns), std::move(evaluateTypes), nullptr /* extraInfo */);
+        std::move(offset), std::move(columns), std::move(evaluateTypes), std::move(extraInfo));
     return std::make_unique<BoundCopyFrom>(std::move(boundCopyFromInfo));
 }
 
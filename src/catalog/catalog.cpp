@@ -4,6 +4,7 @@
 #include "binder/ddl/bound_create_sequence_info.h"
 #include "binder/ddl/bound_create_table_info.h"
 #include "catalog/catalog_entry/function_catalog_entry.h"
+#include "catalog/catalog_entry/index_catalog_entry.h"
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
 #include "catalog/catalog_entry/rdf_graph_catalog_entry.h"
 #include "catalog/catalog_entry/rel_group_catalog_entry.h"
@@ -37,6 +38,7 @@ Catalog::Catalog() {
     sequences = std::make_unique<CatalogSet>();
     functions = std::make_unique<CatalogSet>();
     types = std::make_unique<CatalogSet>();
+    indexes = std::make_unique<CatalogSet>();
     registerBuiltInFunctions();
 }
 
@@ -50,6 +52,7 @@ Catalog::Catalog(const std::string& directory, VirtualFileSystem* vfs) {
         sequences = std::make_unique<CatalogSet>();
         functions = std::make_unique<CatalogSet>();
         types = std::make_unique<CatalogSet>();
+        indexes = std::make_unique<CatalogSet>();
         if (!isInMemMode) {
             // TODO(Guodong): Ideally we should be able to remove this line. Revisit here.
             saveToFile(directory, vfs, FileVersionType::ORIGINAL);
@@ -248,6 +251,10 @@ void Catalog::dropTableEntry(Transaction* transaction, table_id_t tableID) {
             dropSequence(transaction, seqName);
         }
     }
+    // Indexes are dropped before their table, so that WAL replay finds the table to drop them from.
+    for (auto& indexEntry : getIndexEntries(transaction, tableID)) {
+        dropIndex(transaction, indexEntry->getName());
+    }
     tables->dropEntry(transaction, tableEntry->getName(), tableEntry->getOID());
 }
 
@@ -332,6 +339,56 @@ bool Catalog::containsType(const Transaction* transaction, const std::string& ty
     return types->containsEntry(transaction, typeName);
 }
 
+bool Catalog::containsIndex(const Transaction* transaction, const std::string& indexName) const {
+    return indexes->containsEntry(transaction, indexName);
+}
+
+IndexCatalogEntry* Catalog::getIndexCatalogEntry(const Transaction* transaction,
+    const std::string& indexName) const {
+    const auto entry = indexes->getEntry(transaction, indexName);
+    KU_ASSERT(entry);
+    return entry->ptrCast<IndexCatalogEntry>();
+}
+
+std::vector<IndexCatalogEntry*> Catalog::getIndexEntries(const Transaction* transaction) const {
+    std::vector<IndexCatalogEntry*> result;
+    for (auto& [_, entry] : indexes->getEntries(transaction)) {
+        result.push_back(entry->ptrCast<IndexCatalogEntry>());
+    }
+    return result;
+}
+
+std::vector<IndexCatalogEntry*> Catalog::getIndexEntries(const Transaction* transaction,
+    table_id_t tableID) const {
+    std::vector<IndexCatalogEntry*> result;
+    for (auto& [_, entry] : indexes->getEntries(transaction)) {
+        auto indexEntry = entry->ptrCast<IndexCatalogEntry>();
+        if (indexEntry->getTableID() == tableID) {
+            result.push_back(indexEntry);
+        }
+    }
+    return result;
+}
+
+oid_t Catalog::createIndex(Transaction* transaction, std::string name, table_id_t tableID,
+    std::string propertyName, SecondaryIndexType indexType) {
+    KU_ASSERT(!indexes->containsEntry(transaction, name));
+    auto entry = std::make_unique<IndexCatalogEntry>(std::move(name), tableID,
+        std::move(propertyName), indexType);
+    return indexes->createEntry(transaction, std::move(entry));
+}
+
+void Catalog::dropIndex(Transaction* transaction, const std::string& name) {
+    const auto indexEntry = getIndexCatalogEntry(transaction, name);
+    indexes->dropEntry(transaction, indexEntry->getName(), indexEntry->getOID());
+}
+
+void Catalog::dropIndex(Transaction* transaction, oid_t indexID) {
+    const auto indexEntry = indexes->getEntryOfOID(transaction, indexID);
+    KU_ASSERT(indexEntry);
+    indexes->dropEntry(transaction, indexEntry->getName(), indexEntry->getOID());
+}
+
 void Catalog::addFunction(Transaction* transaction, CatalogEntryType entryType, std::string name,
     function::function_set functionSet) {
     if (functions->containsEntry(transaction, name)) {
@@ -453,6 +510,7 @@ void Catalog::saveToFile(const std::string& directory, VirtualFileSystem* fs,
     sequences->serialize(serializer);
     functions->serialize(serializer);
     types->serialize(serializer);
+    indexes->serialize(serializer);
 }
 
 void Catalog::readFromFile(const std::string& directory, VirtualFileSystem* fs,
@@ -469,6 +527,7 @@ void Catalog::readFromFile(const std::string& directory, VirtualFileSystem* fs,
     sequences = CatalogSet::deserialize(deserializer);
     functions = CatalogSet::deserialize(deserializer);
     types = CatalogSet::deserialize(deserializer);
+    indexes = CatalogSet::deserialize(deserializer);
 }
 
 void Catalog::registerBuiltInFunctions() {
@@ -35,6 +35,10 @@ std::string CatalogEntryTypeUtils::toString(CatalogEntryType type) {
         return "DUMMY_ENTRY";
     case CatalogEntryType::SEQUENCE_ENTRY:
         return "SEQUENCE_ENTRY";
+    case CatalogEntryType::TYPE_ENTRY:
+        return "TYPE_ENTRY";
+    case CatalogEntryType::INDEX_ENTRY:
+        return "INDEX_ENTRY";
     default:
         KU_UNREACHABLE;
     }
@@ -0,0 +1,42 @@
+#include "catalog/catalog_entry/index_catalog_entry.h"
+
+#include "catalog/catalog.h"
+#include "common/serializer/deserializer.h"
+#include "common/string_format.h"
+#include "main/client_context.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace catalog {
+
+void IndexCatalogEntry::serialize(Serializer& serializer) const {
+    CatalogEntry::serialize(serializer);
+    serializer.writeDebuggingInfo("tableID");
+    serializer.write(tableID);
+    serializer.writeDebuggingInfo("propertyName");
+    serializer.write(propertyName);
+    serializer.writeDebuggingInfo("indexType");
+    serializer.write(indexType);
+}
+
+std::unique_ptr<IndexCatalogEntry> IndexCatalogEntry::deserialize(Deserializer& deserializer) {
+    std::string debuggingInfo;
+    auto indexEntry = std::make_unique<IndexCatalogEntry>();
+    deserializer.validateDebuggingInfo(debuggingInfo, "tableID");
+    deserializer.deserializeValue(indexEntry->tableID);
+    deserializer.validateDebuggingInfo(debuggingInfo, "propertyName");
+    deserializer.deserializeValue(indexEntry->propertyName);
+    deserializer.validateDebuggingInfo(debuggingInfo, "indexType");
+    deserializer.deserializeValue(indexEntry->indexType);
+    return indexEntry;
+}
+
+std::string IndexCatalogEntry::toCypher(main::ClientContext* clientContext) const {
+    auto tableName = clientContext->getCatalog()->getTableName(clientContext->getTx(), tableID);
+    return stringFormat("CALL CREATE_INDEX('{}', '{}', '{}', '{}') RETURN *;", getName(), tableName,
+        propertyName, SecondaryIndexTypeUtils::toString(indexType));
+}
+
+} // namespace catalog
+} // namespace kuzu
@@ -158,7 +158,12 @@ void CatalogSet::dropEntry(Transaction* transaction, const std::string& name, oi
     }
     KU_ASSERT(entryPtr);
 
-    /* Now, register information of dropped column chunk data into FreeChunkMap */
+    /* Now, register information of dropped column chunk data into FreeChunkMap. Other catalog sets
+     * (indexes, sequences, ...) have OIDs of their own, which must not be taken as table IDs. */
+    if (entryPtr->getType() != CatalogEntryType::NODE_TABLE_ENTRY) {
+        logEntryForTrx(transaction, *this, *entryPtr);
+        return;
+    }
     auto* storageManager = transaction->getClientContext()->getStorageManager();
     auto& freeChunkMap = storageManager->getDataFH()->getFreeChunkMap();
     auto* table = storageManager->getTable(entryPtr->getOID());
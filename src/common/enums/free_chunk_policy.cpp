@@ -0,0 +1,41 @@
+#include "common/enums/free_chunk_policy.h"
+
+#include "common/assert.h"
+#include "common/exception/binder.h"
+#include "common/string_format.h"
+#include "common/string_utils.h"
+
+namespace kuzu {
+namespace common {
+
+FreeChunkPolicy FreeChunkPolicyUtils::fromString(const std::string& str) {
+    auto normalizedStr = StringUtils::getUpper(str);
+    if (normalizedStr == "APPEND_ONLY") {
+        return FreeChunkPolicy::APPEND_ONLY;
+    }
+    if (normalizedStr == "FIRST_FIT") {
+        return FreeChunkPolicy::FIRST_FIT;
+    }
+    if (normalizedStr == "BEST_FIT") {
+        return FreeChunkPolicy::BEST_FIT;
+    }
+    throw BinderException(stringFormat("Cannot parse {} as a free chunk policy. Supported inputs "
+                                       "are [APPEND_ONLY, FIRST_FIT, BEST_FIT]",
+        str));
+}
+
+std::string FreeChunkPolicyUtils::toString(FreeChunkPolicy policy) {
+    switch (policy) {
+    case FreeChunkPolicy::APPEND_ONLY:
+        return "APPEND_ONLY";
+    case FreeChunkPolicy::FIRST_FIT:
+        return "FIRST_FIT";
+    case FreeChunkPolicy::BEST_FIT:
+        return "BEST_FIT";
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+} // namespace common
+} // namespace kuzu
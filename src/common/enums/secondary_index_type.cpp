@@ -0,0 +1,35 @@
+#include "common/enums/secondary_index_type.h"
+
+#include "common/assert.h"
+#include "common/exception/binder.h"
+#include "common/string_format.h"
+#include "common/string_utils.h"
+
+namespace kuzu {
+namespace common {
+
+SecondaryIndexType SecondaryIndexTypeUtils::fromString(const std::string& str) {
+    auto normalizedStr = StringUtils::getUpper(str);
+    if (normalizedStr == "HASH") {
+        return SecondaryIndexType::HASH;
+    }
+    if (normalizedStr == "ORDERED") {
+        return SecondaryIndexType::ORDERED;
+    }
+    throw BinderException(stringFormat(
+        "Cannot parse {} as an index type. Supported inputs are [HASH, ORDERED]", str));
+}
+
+std::string SecondaryIndexTypeUtils::toString(SecondaryIndexType indexType) {
+    switch (indexType) {
+    case SecondaryIndexType::HASH:
+        return "HASH";
+    case SecondaryIndexType::ORDERED:
+        return "ORDERED";
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+} // namespace common
+} // namespace kuzu
@@ -219,8 +219,11 @@ FunctionCollection* FunctionCollection::getFunctions() {
         TABLE_FUNCTION(ShowTablesFunction), TABLE_FUNCTION(ShowWarningsFunction),
         TABLE_FUNCTION(ClearWarningsFunction), TABLE_FUNCTION(TableInfoFunction),
         TABLE_FUNCTION(ShowConnectionFunction), TABLE_FUNCTION(StorageInfoFunction),
-        TABLE_FUNCTION(ShowAttachedDatabasesFunction), TABLE_FUNCTION(ShowSequencesFunction),
-        TABLE_FUNCTION(ShowFunctionsFunction),
+        TABLE_FUNCTION(FreeChunkInfoFunction), TABLE_FUNCTION(ShowAttachedDatabasesFunction),
+        TABLE_FUNCTION(ShowSequencesFunction), TABLE_FUNCTION(ShowFunctionsFunction),
+        TABLE_FUNCTION(WALInfoFunction), TABLE_FUNCTION(BufferPoolInfoFunction),
+        TABLE_FUNCTION(CreateIndexFunction), TABLE_FUNCTION(DropIndexFunction),
+        TABLE_FUNCTION(ShowIndexesFunction),
 
         // Scan functions
         TABLE_FUNCTION(ParquetScanFunction), TABLE_FUNCTION(NpyScanFunction),
@@ -0,0 +1,77 @@
+#include "function/table/call_functions.h"
+#include "main/client_context.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+using namespace kuzu::main;
+
+namespace kuzu {
+namespace function {
+
+struct BufferPoolInfoBindData final : public CallTableFuncBindData {
+    std::vector<FileHandleStats> stats;
+
+    BufferPoolInfoBindData(std::vector<FileHandleStats> stats, std::vector<LogicalType> columnTypes,
+        std::vector<std::string> columnNames, offset_t maxOffset)
+        : CallTableFuncBindData{std::move(columnTypes), std::move(columnNames), maxOffset},
+          stats{std::move(stats)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<BufferPoolInfoBindData>(stats, LogicalType::copy(columnTypes),
+            columnNames, maxOffset);
+    }
+};
+
+static common::offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto& dataChunk = output.dataChunk;
+    auto sharedState = input.sharedState->ptrCast<CallFuncSharedState>();
+    auto morsel = sharedState->getMorsel();
+    if (!morsel.hasMoreToOutput()) {
+        return 0;
+    }
+    auto& stats = input.bindData->constPtrCast<BufferPoolInfoBindData>()->stats;
+    auto numFilesToOutput = morsel.endOffset - morsel.startOffset;
+    for (auto i = 0u; i < numFilesToOutput; i++) {
+        const auto& fileStats = stats[morsel.startOffset + i];
+        const auto numAccesses = fileStats.numPageHits + fileStats.numPageMisses;
+        dataChunk.getValueVectorMutable(0).setValue(i, fileStats.path);
+        dataChunk.getValueVectorMutable(1).setValue<uint64_t>(i, fileStats.numPages);
+        dataChunk.getValueVectorMutable(2).setValue<uint64_t>(i, fileStats.numPageHits);
+        dataChunk.getValueVectorMutable(3).setValue<uint64_t>(i, fileStats.numPageMisses);
+        dataChunk.getValueVectorMutable(4).setValue<uint64_t>(i, fileStats.numPrefetchedPages);
+        dataChunk.getValueVectorMutable(5).setValue<double>(i,
+            numAccesses == 0 ? 0 :
+                               static_cast<double>(fileStats.numPageHits) /
+                                   static_cast<double>(numAccesses));
+    }
+    return numFilesToOutput;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context,
+    ScanTableFuncBindInput*) {
+    std::vector<std::string> columnNames = {"file_path", "num_pages", "num_page_hits",
+        "num_page_misses", "num_prefetched_pages", "hit_rate"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.emplace_back(LogicalType::STRING());
+    columnTypes.emplace_back(LogicalType::INT64());
+    columnTypes.emplace_back(LogicalType::INT64());
+    columnTypes.emplace_back(LogicalType::INT64());
+    columnTypes.emplace_back(LogicalType::INT64());
+    columnTypes.emplace_back(LogicalType::DOUBLE());
+    auto stats = context->getMemoryManager()->getBufferManager()->getFileHandleStats();
+    auto numFiles = stats.size();
+    return std::make_unique<BufferPoolInfoBindData>(std::move(stats), std::move(columnTypes),
+        std::move(columnNames), numFiles);
+}
+
+function_set BufferPoolInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
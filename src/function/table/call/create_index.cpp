@@ -0,0 +1,123 @@
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/index_catalog_entry.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "common/string_format.h"
+#include "function/table/bind_input.h"
+#include "function/table/call_functions.h"
+#include "storage/storage_manager.h"
+#include "storage/store/node_table.h"
+
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+struct CreateIndexBindData final : CallTableFuncBindData {
+    main::ClientContext* context;
+    std::string indexName;
+    table_id_t tableID;
+    std::string propertyName;
+    SecondaryIndexType indexType;
+
+    CreateIndexBindData(main::ClientContext* context, std::string indexName, table_id_t tableID,
+        std::string propertyName, SecondaryIndexType indexType,
+        std::vector<LogicalType> returnTypes, std::vector<std::string> returnColumnNames)
+        : CallTableFuncBindData{std::move(returnTypes), std::move(returnColumnNames),
+              1 /* maxOffset */},
+          context{context}, indexName{std::move(indexName)}, tableID{tableID},
+          propertyName{std::move(propertyName)}, indexType{indexType} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<CreateIndexBindData>(context, indexName, tableID, propertyName,
+            indexType, LogicalType::copy(columnTypes), columnNames);
+    }
+};
+
+static void validateIndexNotExists(main::ClientContext* context, const std::string& indexName) {
+    if (context->getCatalog()->containsIndex(context->getTx(), indexName)) {
+        throw BinderException(stringFormat("Index {} already exists.", indexName));
+    }
+}
+
+static common::offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto sharedState = input.sharedState->ptrCast<CallFuncSharedState>();
+    auto morsel = sharedState->getMorsel();
+    if (!morsel.hasMoreToOutput()) {
+        return 0;
+    }
+    auto bindData = input.bindData->constPtrCast<CreateIndexBindData>();
+    auto context = bindData->context;
+    auto transaction = context->getTx();
+    auto catalog = context->getCatalog();
+    // A prepared statement may be executed more than once.
+    validateIndexNotExists(context, bindData->indexName);
+    catalog->createIndex(transaction, bindData->indexName, bindData->tableID,
+        bindData->propertyName, bindData->indexType);
+    auto tableEntry = catalog->getTableCatalogEntry(transaction, bindData->tableID);
+    auto& table =
+        context->getStorageManager()->getTable(bindData->tableID)->cast<storage::NodeTable>();
+    table.createSecondaryIndex(transaction,
+        *catalog->getIndexCatalogEntry(transaction, bindData->indexName),
+        tableEntry->getColumnID(bindData->propertyName));
+    output.dataChunk.getValueVectorMutable(0).setValue(0,
+        stringFormat("Index {} has been created.", bindData->indexName));
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    ScanTableFuncBindInput* input) {
+    auto indexName = input->inputs[0].getValue<std::string>();
+    auto tableName = input->inputs[1].getValue<std::string>();
+    auto propertyName = input->inputs[2].getValue<std::string>();
+    auto indexType = SecondaryIndexType::HASH;
+    if (input->inputs.size() > 3) {
+        indexType = SecondaryIndexTypeUtils::fromString(input->inputs[3].getValue<std::string>());
+    }
+    auto catalog = context->getCatalog();
+    auto transaction = context->getTx();
+    validateIndexNotExists(context, indexName);
+    if (!catalog->containsTable(transaction, tableName)) {
+        throw BinderException(stringFormat("Table {} does not exist.", tableName));
+    }
+    auto tableEntry =
+        catalog->getTableCatalogEntry(transaction, catalog->getTableID(transaction, tableName));
+    if (tableEntry->getTableType() != TableType::NODE) {
+        throw BinderException(
+            stringFormat("Cannot create index on {}. Indexes are only supported on node tables.",
+                tableName));
+    }
+    if (!tableEntry->containsProperty(propertyName)) {
+        throw BinderException(
+            stringFormat("Table {} does not have a property {}.", tableName, propertyName));
+    }
+    auto& propertyType = tableEntry->getProperty(propertyName).getType();
+    if (!storage::SecondaryIndex::isKeyTypeSupported(propertyType.getPhysicalType())) {
+        throw BinderException(stringFormat("Cannot create index on property {} of type {}.",
+            propertyName, propertyType.toString()));
+    }
+    std::vector<std::string> columnNames;
+    std::vector<LogicalType> columnTypes;
+    columnNames.emplace_back("result");
+    columnTypes.push_back(LogicalType::STRING());
+    return std::make_unique<CreateIndexBindData>(context, std::move(indexName),
+        tableEntry->getTableID(), std::move(propertyName), indexType, std::move(columnTypes),
+        std::move(columnNames));
+}
+
+function_set CreateIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState,
+        std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING,
+            LogicalTypeID::STRING}));
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState,
+        std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING,
+            LogicalTypeID::STRING, LogicalTypeID::STRING}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
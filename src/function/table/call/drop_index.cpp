@@ -0,0 +1,70 @@
+#include "catalog/catalog.h"
+#include "common/exception/binder.h"
+#include "common/string_format.h"
+#include "function/table/bind_input.h"
+#include "function/table/call_functions.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+struct DropIndexBindData final : CallTableFuncBindData {
+    main::ClientContext* context;
+    std::string indexName;
+
+    DropIndexBindData(main::ClientContext* context, std::string indexName,
+        std::vector<LogicalType> returnTypes, std::vector<std::string> returnColumnNames)
+        : CallTableFuncBindData{std::move(returnTypes), std::move(returnColumnNames),
+              1 /* maxOffset */},
+          context{context}, indexName{std::move(indexName)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<DropIndexBindData>(context, indexName,
+            LogicalType::copy(columnTypes), columnNames);
+    }
+};
+
+static void validateIndexExists(main::ClientContext* context, const std::string& indexName) {
+    if (!context->getCatalog()->containsIndex(context->getTx(), indexName)) {
+        throw BinderException(stringFormat("Index {} does not exist.", indexName));
+    }
+}
+
+// The index is removed from its table at the next checkpoint.
+static common::offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto sharedState = input.sharedState->ptrCast<CallFuncSharedState>();
+    auto morsel = sharedState->getMorsel();
+    if (!morsel.hasMoreToOutput()) {
+        return 0;
+    }
+    auto bindData = input.bindData->constPtrCast<DropIndexBindData>();
+    // A prepared statement may be executed more than once.
+    validateIndexExists(bindData->context, bindData->indexName);
+    bindData->context->getCatalog()->dropIndex(bindData->context->getTx(), bindData->indexName);
+    output.dataChunk.getValueVectorMutable(0).setValue(0,
+        stringFormat("Index {} has been dropped.", bindData->indexName));
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    ScanTableFuncBindInput* input) {
+    auto indexName = input->inputs[0].getValue<std::string>();
+    validateIndexExists(context, indexName);
+    std::vector<std::string> columnNames;
+    std::vector<LogicalType> columnTypes;
+    columnNames.emplace_back("result");
+    columnTypes.push_back(LogicalType::STRING());
+    return std::make_unique<DropIndexBindData>(context, std::move(indexName),
+        std::move(columnTypes), std::move(columnNames));
+}
+
+function_set DropIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{LogicalTypeID::STRING}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
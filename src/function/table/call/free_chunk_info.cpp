@@ -0,0 +1,88 @@
+#include "common/constants.h"
+#include "function/table/call_functions.h"
+#include "main/client_context.h"
+#include "storage/file_handle.h"
+#include "storage/storage_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+using namespace kuzu::main;
+
+namespace kuzu {
+namespace function {
+
+struct FreeChunkInfoBindData final : public CallTableFuncBindData {
+    FreeChunkMapStats stats;
+
+    FreeChunkInfoBindData(std::vector<LogicalType> columnTypes,
+        std::vector<std::string> columnNames, FreeChunkMapStats stats)
+        : CallTableFuncBindData{std::move(columnTypes), std::move(columnNames), 1 /*maxOffset*/},
+          stats{stats} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<FreeChunkInfoBindData>(LogicalType::copy(columnTypes), columnNames,
+            stats);
+    }
+};
+
+static common::offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto& dataChunk = output.dataChunk;
+    auto sharedState = input.sharedState->ptrCast<CallFuncSharedState>();
+    if (!sharedState->getMorsel().hasMoreToOutput()) {
+        return 0;
+    }
+    auto& stats = input.bindData->constPtrCast<FreeChunkInfoBindData>()->stats;
+    auto pos = dataChunk.state->getSelVector()[0];
+    dataChunk.getValueVectorMutable(0).setValue<uint64_t>(pos, stats.numFreeChunks);
+    dataChunk.getValueVectorMutable(1).setValue<uint64_t>(pos, stats.numFreePages);
+    dataChunk.getValueVectorMutable(2).setValue<uint64_t>(pos, stats.largestFreeChunk);
+    dataChunk.getValueVectorMutable(3).setValue<double>(pos, stats.fragmentation);
+    dataChunk.getValueVectorMutable(4).setValue<uint64_t>(pos, stats.numReusedPages);
+    dataChunk.getValueVectorMutable(5).setValue<uint64_t>(pos,
+        stats.numReusedPages * PAGE_SIZE);
+    dataChunk.getValueVectorMutable(6).setValue(pos,
+        FreeChunkPolicyUtils::toString(stats.policy));
+    dataChunk.getValueVectorMutable(7).setValue<uint64_t>(pos, stats.numAppendedPages);
+    std::vector<std::unique_ptr<Value>> buckets;
+    for (const auto numAllocations : stats.allocationLatencyHistogram) {
+        buckets.push_back(std::make_unique<Value>(static_cast<int64_t>(numAllocations)));
+    }
+    dataChunk.getValueVectorMutable(8).copyFromValue(pos,
+        Value(LogicalType::LIST(LogicalType::INT64()), std::move(buckets)));
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context,
+    ScanTableFuncBindInput*) {
+    std::vector<std::string> columnNames = {"num_free_chunks", "num_free_pages",
+        "largest_free_chunk", "fragmentation", "num_reused_pages", "reclaimed_bytes", "policy",
+        "num_appended_pages", "allocation_latency_histogram"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.emplace_back(LogicalType::INT64());
+    columnTypes.emplace_back(LogicalType::INT64());
+    columnTypes.emplace_back(LogicalType::INT64());
+    columnTypes.emplace_back(LogicalType::DOUBLE());
+    columnTypes.emplace_back(LogicalType::INT64());
+    columnTypes.emplace_back(LogicalType::INT64());
+    columnTypes.emplace_back(LogicalType::STRING());
+    columnTypes.emplace_back(LogicalType::INT64());
+    // Bucket i counts allocations that took less than 2^i nanoseconds.
+    columnTypes.emplace_back(LogicalType::LIST(LogicalType::INT64()));
+    FreeChunkMapStats stats;
+    auto dataFH = context->getStorageManager()->getDataFH();
+    if (dataFH != nullptr) {
+        stats = dataFH->getFreeChunkMap().getStats();
+    }
+    return std::make_unique<FreeChunkInfoBindData>(std::move(columnTypes),
+        std::move(columnNames), stats);
+}
+
+function_set FreeChunkInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
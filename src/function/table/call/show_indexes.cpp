@@ -0,0 +1,91 @@
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/index_catalog_entry.h"
+#include "function/table/call_functions.h"
+
+using namespace kuzu::common;
+using namespace kuzu::catalog;
+
+namespace kuzu {
+namespace function {
+
+struct IndexInfo {
+    std::string name;
+    std::string tableName;
+    std::string propertyName;
+    std::string indexType;
+
+    IndexInfo(std::string name, std::string tableName, std::string propertyName,
+        std::string indexType)
+        : name{std::move(name)}, tableName{std::move(tableName)},
+          propertyName{std::move(propertyName)}, indexType{std::move(indexType)} {}
+};
+
+struct ShowIndexesBindData final : CallTableFuncBindData {
+    std::vector<IndexInfo> indexes;
+
+    ShowIndexesBindData(std::vector<IndexInfo> indexes, std::vector<LogicalType> returnTypes,
+        std::vector<std::string> returnColumnNames, offset_t maxOffset)
+        : CallTableFuncBindData{std::move(returnTypes), std::move(returnColumnNames), maxOffset},
+          indexes{std::move(indexes)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<ShowIndexesBindData>(indexes, LogicalType::copy(columnTypes),
+            columnNames, maxOffset);
+    }
+};
+
+static common::offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto& dataChunk = output.dataChunk;
+    auto sharedState = input.sharedState->ptrCast<CallFuncSharedState>();
+    auto morsel = sharedState->getMorsel();
+    if (!morsel.hasMoreToOutput()) {
+        return 0;
+    }
+    auto& indexes = input.bindData->constPtrCast<ShowIndexesBindData>()->indexes;
+    auto numIndexesToOutput = morsel.endOffset - morsel.startOffset;
+    for (auto i = 0u; i < numIndexesToOutput; i++) {
+        auto& indexInfo = indexes[morsel.startOffset + i];
+        dataChunk.getValueVectorMutable(0).setValue(i, indexInfo.name);
+        dataChunk.getValueVectorMutable(1).setValue(i, indexInfo.tableName);
+        dataChunk.getValueVectorMutable(2).setValue(i, indexInfo.propertyName);
+        dataChunk.getValueVectorMutable(3).setValue(i, indexInfo.indexType);
+    }
+    return numIndexesToOutput;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    ScanTableFuncBindInput*) {
+    std::vector<std::string> columnNames;
+    std::vector<LogicalType> columnTypes;
+    columnNames.emplace_back("name");
+    columnTypes.emplace_back(LogicalType::STRING());
+    columnNames.emplace_back("table name");
+    columnTypes.emplace_back(LogicalType::STRING());
+    columnNames.emplace_back("property name");
+    columnTypes.emplace_back(LogicalType::STRING());
+    columnNames.emplace_back("index type");
+    columnTypes.emplace_back(LogicalType::STRING());
+    std::vector<IndexInfo> indexInfos;
+    auto catalog = context->getCatalog();
+    auto transaction = context->getTx();
+    for (auto& entry : catalog->getIndexEntries(transaction)) {
+        indexInfos.emplace_back(entry->getName(),
+            catalog->getTableName(transaction, entry->getTableID()), entry->getPropertyName(),
+            SecondaryIndexTypeUtils::toString(entry->getIndexType()));
+    }
+    std::sort(indexInfos.begin(), indexInfos.end(),
+        [](const auto& a, const auto& b) { return a.name < b.name; });
+    auto numIndexes = indexInfos.size();
+    return std::make_unique<ShowIndexesBindData>(std::move(indexInfos), std::move(columnTypes),
+        std::move(columnNames), numIndexes);
+}
+
+function_set ShowIndexesFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,86 @@
+#include "function/table/call_functions.h"
+#include "main/client_context.h"
+#include "main/db_config.h"
+#include "storage/storage_manager.h"
+#include "storage/wal/wal.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+using namespace kuzu::main;
+
+namespace kuzu {
+namespace function {
+
+struct WALInfoBindData final : public CallTableFuncBindData {
+    uint64_t walFileSize;
+    WALGroupCommitStats stats;
+
+    WALInfoBindData(std::vector<LogicalType> columnTypes, std::vector<std::string> columnNames,
+        uint64_t walFileSize, WALGroupCommitStats stats)
+        : CallTableFuncBindData{std::move(columnTypes), std::move(columnNames), 1 /*maxOffset*/},
+          walFileSize{walFileSize}, stats{stats} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<WALInfoBindData>(LogicalType::copy(columnTypes), columnNames,
+            walFileSize, stats);
+    }
+};
+
+static common::offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto& dataChunk = output.dataChunk;
+    auto sharedState = input.sharedState->ptrCast<CallFuncSharedState>();
+    if (!sharedState->getMorsel().hasMoreToOutput()) {
+        return 0;
+    }
+    auto bindData = input.bindData->constPtrCast<WALInfoBindData>();
+    auto& stats = bindData->stats;
+    auto pos = dataChunk.state->getSelVector()[0];
+    dataChunk.getValueVectorMutable(0).setValue<uint64_t>(pos, bindData->walFileSize);
+    dataChunk.getValueVectorMutable(1).setValue<uint64_t>(pos, stats.numSyncedCommits);
+    dataChunk.getValueVectorMutable(2).setValue<uint64_t>(pos, stats.numSyncs);
+    dataChunk.getValueVectorMutable(3).setValue<double>(pos,
+        stats.numSyncs == 0 ? 0 :
+                              static_cast<double>(stats.numSyncedCommits) /
+                                  static_cast<double>(stats.numSyncs));
+    dataChunk.getValueVectorMutable(4).setValue<uint64_t>(pos, stats.maxBatchSize);
+    std::vector<std::unique_ptr<Value>> buckets;
+    for (const auto numSyncs : stats.syncLatencyHistogram) {
+        buckets.push_back(std::make_unique<Value>(static_cast<int64_t>(numSyncs)));
+    }
+    dataChunk.getValueVectorMutable(5).copyFromValue(pos,
+        Value(LogicalType::LIST(LogicalType::INT64()), std::move(buckets)));
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context,
+    ScanTableFuncBindInput*) {
+    std::vector<std::string> columnNames = {"wal_file_size", "num_synced_commits", "num_syncs",
+        "avg_batch_size", "max_batch_size", "sync_latency_histogram"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.emplace_back(LogicalType::INT64());
+    columnTypes.emplace_back(LogicalType::INT64());
+    columnTypes.emplace_back(LogicalType::INT64());
+    columnTypes.emplace_back(LogicalType::DOUBLE());
+    columnTypes.emplace_back(LogicalType::INT64());
+    // Bucket i counts syncs that took less than 2^i microseconds.
+    columnTypes.emplace_back(LogicalType::LIST(LogicalType::INT64()));
+    uint64_t walFileSize = 0;
+    WALGroupCommitStats stats;
+    if (!DBConfig::isDBPathInMemory(context->getDatabasePath())) {
+        auto& wal = context->getStorageManager()->getWAL();
+        walFileSize = wal.getFileSize();
+        stats = wal.getGroupCommitStats();
+    }
+    return std::make_unique<WALInfoBindData>(std::move(columnTypes), std::move(columnNames),
+        walFileSize, stats);
+}
+
+function_set WALInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
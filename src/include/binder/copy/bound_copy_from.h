@@ -49,6 +49,19 @@ private:
     }
 };
 
+struct ExtraBoundCopyNodeInfo final : public ExtraBoundCopyFromInfo {
+    // Source column to sort rows by before writing them into node groups.
+    std::shared_ptr<Expression> clusterKey;
+
+    explicit ExtraBoundCopyNodeInfo(std::shared_ptr<Expression> clusterKey)
+        : clusterKey{std::move(clusterKey)} {}
+    ExtraBoundCopyNodeInfo(const ExtraBoundCopyNodeInfo& other) = default;
+
+    std::unique_ptr<ExtraBoundCopyFromInfo> copy() const override {
+        return std::make_unique<ExtraBoundCopyNodeInfo>(*this);
+    }
+};
+
 struct ExtraBoundCopyRelInfo final : public ExtraBoundCopyFromInfo {
     // We process internal ID column as offset (INT64) column until partitioner. In partitioner,
     // we need to manually change offset(INT64) type to internal ID type.
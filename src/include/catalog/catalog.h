@@ -3,6 +3,7 @@
 #include "catalog/catalog_entry/function_catalog_entry.h"
 #include "catalog/catalog_set.h"
 #include "common/cast.h"
+#include "common/enums/secondary_index_type.h"
 #include "function/function.h"
 
 namespace kuzu::main {
@@ -44,6 +45,7 @@ class RelGroupCatalogEntry;
 class RDFGraphCatalogEntry;
 class FunctionCatalogEntry;
 class SequenceCatalogEntry;
+class IndexCatalogEntry;
 
 class KUZU_API Catalog {
     friend class main::AttachedKuzuDatabase;
@@ -122,6 +124,22 @@ public:
     bool containsType(const transaction::Transaction* transaction,
         const std::string& typeName) const;
 
+    // ----------------------------- Indexes ----------------------------
+    bool containsIndex(const transaction::Transaction* transaction,
+        const std::string& indexName) const;
+    IndexCatalogEntry* getIndexCatalogEntry(const transaction::Transaction* transaction,
+        const std::string& indexName) const;
+    std::vector<IndexCatalogEntry*> getIndexEntries(
+        const transaction::Transaction* transaction) const;
+    std::vector<IndexCatalogEntry*> getIndexEntries(const transaction::Transaction* transaction,
+        common::table_id_t tableID) const;
+
+    common::oid_t createIndex(transaction::Transaction* transaction, std::string name,
+        common::table_id_t tableID, std::string propertyName,
+        common::SecondaryIndexType indexType);
+    void dropIndex(transaction::Transaction* transaction, const std::string& name);
+    void dropIndex(transaction::Transaction* transaction, common::oid_t indexID);
+
     // ----------------------------- Functions ----------------------------
     void addFunction(transaction::Transaction* transaction, CatalogEntryType entryType,
         std::string name, function::function_set functionSet);
@@ -200,6 +218,7 @@ private:
     std::unique_ptr<CatalogSet> sequences;
     std::unique_ptr<CatalogSet> functions;
     std::unique_ptr<CatalogSet> types;
+    std::unique_ptr<CatalogSet> indexes;
 };
 
 } // namespace catalog
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "catalog_entry.h"
+#include "common/enums/secondary_index_type.h"
+
+namespace kuzu {
+namespace catalog {
+
+// A secondary index on a property of a node table. The index data itself is owned by the NodeTable.
+class KUZU_API IndexCatalogEntry final : public CatalogEntry {
+public:
+    //===--------------------------------------------------------------------===//
+    // constructors
+    //===--------------------------------------------------------------------===//
+    IndexCatalogEntry() = default;
+    IndexCatalogEntry(std::string name, common::table_id_t tableID, std::string propertyName,
+        common::SecondaryIndexType indexType)
+        : CatalogEntry{CatalogEntryType::INDEX_ENTRY, std::move(name)}, tableID{tableID},
+          propertyName{std::move(propertyName)}, indexType{indexType} {}
+
+    //===--------------------------------------------------------------------===//
+    // getter & setter
+    //===--------------------------------------------------------------------===//
+    common::table_id_t getTableID() const { return tableID; }
+    std::string getPropertyName() const { return propertyName; }
+    common::SecondaryIndexType getIndexType() const { return indexType; }
+
+    //===--------------------------------------------------------------------===//
+    // serialization & deserialization
+    //===--------------------------------------------------------------------===//
+    void serialize(common::Serializer& serializer) const override;
+    static std::unique_ptr<IndexCatalogEntry> deserialize(common::Deserializer& deserializer);
+    std::string toCypher(main::ClientContext* clientContext) const override;
+
+private:
+    common::table_id_t tableID = common::INVALID_TABLE_ID;
+    std::string propertyName;
+    common::SecondaryIndexType indexType = common::SecondaryIndexType::HASH;
+};
+
+} // namespace catalog
+} // namespace kuzu
@@ -85,6 +85,9 @@ struct BufferPoolConstants {
     static constexpr uint64_t DEFAULT_VM_REGION_MAX_SIZE = static_cast<uint64_t>(1) << 43; // (8TB)
 #endif
     static constexpr uint64_t DEFAULT_BUFFER_POOL_SIZE_FOR_TESTING = 1ull << 28; // (256MB)
+    // The max number of pages read by a single prefetch. Sequential scans prefetch the pages of
+    // each column chunk at most this many pages ahead of the rows being scanned.
+    static constexpr uint64_t MAX_PREFETCH_NUM_PAGES = 64;
 };
 
 struct StorageConstants {
@@ -136,6 +139,8 @@ struct CopyConstants {
     static constexpr uint64_t PARALLEL_BLOCK_SIZE = INITIAL_BUFFER_SIZE / 2;
 
     static constexpr const char* IGNORE_ERRORS_OPTION_NAME = "IGNORE_ERRORS";
+    // Sorts node rows by the given column before they are written into node groups.
+    static constexpr const char* CLUSTER_BY_OPTION_NAME = "CLUSTER_BY";
     static constexpr const char* BOOL_CSV_PARSING_OPTIONS[] = {"HEADER", "PARALLEL",
         "LIST_UNBRACED", CopyConstants::IGNORE_ERRORS_OPTION_NAME};
     static constexpr bool DEFAULT_CSV_HAS_HEADER = false;
@@ -193,6 +198,9 @@ struct PlannerKnobs {
     static constexpr double NON_EQUALITY_PREDICATE_SELECTIVITY = 0.1;
     static constexpr double EQUALITY_PREDICATE_SELECTIVITY = 0.01;
     static constexpr uint64_t BUILD_PENALTY = 2;
+    // Fetching a node found through a secondary index is a random lookup, while a table scan reads
+    // nodes in vectors. An index scan is only chosen if it is expected to be cheaper.
+    static constexpr uint64_t SECONDARY_INDEX_LOOKUP_PENALTY = 10;
     // Avoid doing probe to build SIP if we have to accumulate a probe side that is much bigger than
     // build side. Also avoid doing build to probe SIP if probe side is not much bigger than build.
     static constexpr uint64_t SIP_RATIO = 5;
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace kuzu {
+namespace common {
+
+// Decides where new column chunks are placed in the data file.
+enum class FreeChunkPolicy : uint8_t {
+    // Never reuse freed pages. New chunks are always appended to the end of the file.
+    APPEND_ONLY = 0,
+    // Reuse the free extent with the lowest start page that is large enough.
+    FIRST_FIT = 1,
+    // Reuse the smallest free extent that is large enough.
+    BEST_FIT = 2,
+};
+
+struct FreeChunkPolicyUtils {
+    static FreeChunkPolicy fromString(const std::string& str);
+    static std::string toString(FreeChunkPolicy policy);
+};
+
+} // namespace common
+} // namespace kuzu
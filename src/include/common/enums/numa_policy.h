@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+
+namespace kuzu {
+namespace common {
+
+// Decides on which NUMA nodes the physical memory backing buffer manager frames is allocated.
+enum class NumaPolicy : uint8_t {
+    // Keep the memory policy of the process, which is first-touch unless changed e.g. by numactl.
+    DEFAULT = 0,
+    // Spread frames page by page across all NUMA nodes the process may allocate memory on.
+    INTERLEAVE = 1,
+    // Allocate each frame on the node of the CPU that first touches it, regardless of the
+    // memory policy of the process.
+    LOCAL = 2,
+};
+
+} // namespace common
+} // namespace kuzu
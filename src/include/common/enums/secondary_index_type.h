@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace kuzu {
+namespace common {
+
+// The kind of a secondary (non primary key) index on a node property.
+enum class SecondaryIndexType : uint8_t {
+    // Keyed by a hash of the value. Only supports equality lookups.
+    HASH = 0,
+    // Keyed by an order-preserving encoding of the value.
+    ORDERED = 1,
+};
+
+struct SecondaryIndexTypeUtils {
+    static SecondaryIndexType fromString(const std::string& str);
+    static std::string toString(SecondaryIndexType indexType);
+};
+
+} // namespace common
+} // namespace kuzu
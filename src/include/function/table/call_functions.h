@@ -105,6 +105,24 @@ struct StorageInfoFunction final : CallFunction {
     static function_set getFunctionSet();
 };
 
+struct FreeChunkInfoFunction final : CallFunction {
+    static constexpr const char* name = "FREE_CHUNK_INFO";
+
+    static function_set getFunctionSet();
+};
+
+struct BufferPoolInfoFunction final : CallFunction {
+    static constexpr const char* name = "BUFFER_POOL_INFO";
+
+    static function_set getFunctionSet();
+};
+
+struct WALInfoFunction final : CallFunction {
+    static constexpr const char* name = "WAL_INFO";
+
+    static function_set getFunctionSet();
+};
+
 struct ShowAttachedDatabasesFunction final : CallFunction {
     static constexpr const char* name = "SHOW_ATTACHED_DATABASES";
 
@@ -117,5 +135,25 @@ struct ShowFunctionsFunction : public CallFunction {
     static function_set getFunctionSet();
 };
 
+// CREATE_INDEX(name, table, property[, type]) creates a secondary index on a node table property.
+// The type is HASH (the default) or ORDERED.
+struct CreateIndexFunction final : CallFunction {
+    static constexpr const char* name = "CREATE_INDEX";
+
+    static function_set getFunctionSet();
+};
+
+struct DropIndexFunction final : CallFunction {
+    static constexpr const char* name = "DROP_INDEX";
+
+    static function_set getFunctionSet();
+};
+
+struct ShowIndexesFunction final : CallFunction {
+    static constexpr const char* name = "SHOW_INDEXES";
+
+    static function_set getFunctionSet();
+};
+
 } // namespace function
 } // namespace kuzu
@@ -2,10 +2,13 @@
 
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <vector>
 
 #include "common/api.h"
 #include "common/case_insensitive_map.h"
+#include "common/enums/free_chunk_policy.h"
+#include "common/enums/numa_policy.h"
 #include "kuzu_fwd.h"
 #include "main/db_config.h"
 
@@ -61,10 +64,20 @@ struct KUZU_API SystemConfig {
      * the WAL file exceeds the checkpoint threshold.
      * @param checkpointThreshold The threshold of the WAL file size in bytes. When the size of the
      * WAL file exceeds this threshold, the database will checkpoint if autoCheckpoint is true.
+     * @param freeChunkPolicy How freed pages of the data file are reused when new column chunks
+     * are written. If not set, an existing database keeps the policy persisted at its last
+     * checkpoint and a new database uses best fit. If set, it replaces the persisted policy.
+     * @param useHugePages If true, the memory of the buffer pool is backed by transparent huge pages
+     * (2MB on x86-64) where the operating system supports them, which reduces TLB misses when
+     * scanning large tables or probing large hash tables. Only applies on Linux.
+     * @param numaPolicy On which NUMA nodes the memory of the buffer pool is allocated. Only
+     * applies on Linux.
      */
     explicit SystemConfig(uint64_t bufferPoolSize = -1u, uint64_t maxNumThreads = 0,
         bool enableCompression = true, bool readOnly = false, uint64_t maxDBSize = -1u,
-        bool autoCheckpoint = true, uint64_t checkpointThreshold = 16777216 /* 16MB */);
+        bool autoCheckpoint = true, uint64_t checkpointThreshold = 16777216 /* 16MB */,
+        std::optional<common::FreeChunkPolicy> freeChunkPolicy = std::nullopt,
+        bool useHugePages = false, common::NumaPolicy numaPolicy = common::NumaPolicy::DEFAULT);
 
     uint64_t bufferPoolSize;
     uint64_t maxNumThreads;
@@ -73,6 +86,9 @@ struct KUZU_API SystemConfig {
     uint64_t maxDBSize;
     bool autoCheckpoint;
     uint64_t checkpointThreshold;
+    std::optional<common::FreeChunkPolicy> freeChunkPolicy;
+    bool useHugePages;
+    common::NumaPolicy numaPolicy;
 };
 
 /**
@@ -3,6 +3,8 @@
 #include <optional>
 #include <string>
 
+#include "common/enums/free_chunk_policy.h"
+#include "common/enums/numa_policy.h"
 #include "common/types/value/value.h"
 
 namespace kuzu {
@@ -61,6 +63,16 @@ struct DBConfig {
     bool autoCheckpoint;
     uint64_t checkpointThreshold;
     bool forceCheckpointOnClose;
+    bool checkpointCompaction;
+    double nodeGroupRewriteThreshold;
+    common::FreeChunkPolicy freeChunkPolicy;
+    // If true, an auto checkpoint is skipped instead of blocking new transactions while waiting for
+    // active ones to leave. It is retried at the next commit of a write transaction.
+    bool nonBlockingAutoCheckpoint;
+    // Time a group commit leader waits for more commits to join its batch before syncing the WAL.
+    uint64_t groupCommitMaxDelayInMicros;
+    bool useHugePages;
+    common::NumaPolicy numaPolicy;
     std::optional<std::string> spillToDiskTmpFile;
 
     explicit DBConfig(const SystemConfig& systemConfig);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common/exception/not_implemented.h"
+#include "common/exception/runtime.h"
 #include "common/types/value/value.h"
 #include "main/client_context.h"
 #include "main/db_config.h"
@@ -223,6 +224,70 @@ struct ForceCheckpointClosingDBSetting {
     }
 };
 
+struct CheckpointCompactionSetting {
+    static constexpr auto name = "checkpoint_compaction";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        context->getDBConfigUnsafe()->checkpointCompaction = parameter.getValue<bool>();
+    }
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getDBConfig()->checkpointCompaction);
+    }
+};
+
+struct NodeGroupRewriteThresholdSetting {
+    static constexpr auto name = "node_group_rewrite_threshold";
+    static constexpr auto inputType = common::LogicalTypeID::DOUBLE;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        auto threshold = parameter.getValue<double>();
+        if (threshold <= 0 || threshold > 1) {
+            throw common::RuntimeException(
+                "Node group rewrite threshold must be greater than 0 and at most 1.");
+        }
+        context->getDBConfigUnsafe()->nodeGroupRewriteThreshold = threshold;
+    }
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getDBConfig()->nodeGroupRewriteThreshold);
+    }
+};
+
+struct FreeChunkPolicySetting {
+    static constexpr auto name = "free_chunk_policy";
+    static constexpr auto inputType = common::LogicalTypeID::STRING;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct NonBlockingAutoCheckpointSetting {
+    static constexpr auto name = "non_blocking_auto_checkpoint";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        context->getDBConfigUnsafe()->nonBlockingAutoCheckpoint = parameter.getValue<bool>();
+    }
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getDBConfig()->nonBlockingAutoCheckpoint);
+    }
+};
+
+struct GroupCommitMaxDelaySetting {
+    static constexpr auto name = "group_commit_max_delay";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        auto maxDelayInMicros = parameter.getValue<int64_t>();
+        if (maxDelayInMicros < 0) {
+            throw common::RuntimeException("Group commit max delay cannot be negative.");
+        }
+        context->getDBConfigUnsafe()->groupCommitMaxDelayInMicros = maxDelayInMicros;
+    }
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getDBConfig()->groupCommitMaxDelayInMicros);
+    }
+};
+
 struct SpillToDiskFileSetting {
     static constexpr auto name = "spill_to_disk_tmp_file";
     static constexpr auto inputType = common::LogicalTypeID::STRING;
@@ -14,6 +14,8 @@ class Transaction;
 
 namespace planner {
 
+struct SecondaryIndexScanInfo;
+
 class CardinalityEstimator {
 public:
     CardinalityEstimator() : context{nullptr} {};
@@ -33,10 +35,16 @@ public:
         const LogicalPlan& probePlan, const std::vector<std::unique_ptr<LogicalPlan>>& buildPlans);
     uint64_t estimateFlatten(const LogicalPlan& childPlan, f_group_pos groupPosToFlatten);
     uint64_t estimateFilter(const LogicalPlan& childPlan, const binder::Expression& predicate);
+    // Estimates the number of candidates a secondary index scan of the table returns. Literal
+    // bounds are looked up in the index, other ones fall back to the default selectivities.
+    uint64_t estimateSecondaryIndexScan(common::table_id_t tableID,
+        const SecondaryIndexScanInfo& info);
 
     double getExtensionRate(const binder::RelExpression& rel,
         const binder::NodeExpression& boundNode);
 
+    uint64_t getNumNodes(const std::vector<common::table_id_t>& tableIDs);
+
 private:
     uint64_t atLeastOne(uint64_t x) { return x == 0 ? 1 : x; }
 
@@ -44,8 +52,6 @@ private:
         KU_ASSERT(nodeIDName2dom.contains(nodeIDName));
         return nodeIDName2dom.at(nodeIDName);
     }
-    uint64_t getNumNodes(const std::vector<common::table_id_t>& tableIDs);
-
     uint64_t getNumRels(const std::vector<common::table_id_t>& tableIDs);
 
 private:
@@ -16,6 +16,8 @@ public:
         const LogicalPlan& probe, const LogicalPlan& build);
     static uint64_t computeIntersectCost(const LogicalPlan& probePlan,
         const std::vector<std::unique_ptr<LogicalPlan>>& buildPlans);
+    static uint64_t computeSecondaryIndexScanCost(uint64_t numCandidates);
+    static uint64_t computeScanNodeTableCost(uint64_t numNodes);
 };
 
 } // namespace planner
@@ -11,6 +11,7 @@ enum class LogicalScanNodeTableType : uint8_t {
     SCAN = 0,
     OFFSET_SCAN = 1,
     PRIMARY_KEY_SCAN = 2,
+    SECONDARY_INDEX_SCAN = 3,
 };
 
 struct ExtraScanNodeTableInfo {
@@ -47,6 +48,30 @@ struct PrimaryKeyScanInfo final : ExtraScanNodeTableInfo {
     }
 };
 
+// The index returns a superset of the nodes whose property is between the bounds, so the predicates
+// are still evaluated by a filter above the scan. Equality lookups use the key as both bounds. A
+// null bound leaves that side of the range open.
+struct SecondaryIndexScanInfo final : ExtraScanNodeTableInfo {
+    common::oid_t indexID;
+    std::string indexName;
+    std::shared_ptr<binder::Expression> lowerBound;
+    std::shared_ptr<binder::Expression> upperBound;
+
+    SecondaryIndexScanInfo(common::oid_t indexID, std::string indexName,
+        std::shared_ptr<binder::Expression> lowerBound,
+        std::shared_ptr<binder::Expression> upperBound)
+        : indexID{indexID}, indexName{std::move(indexName)}, lowerBound{std::move(lowerBound)},
+          upperBound{std::move(upperBound)} {}
+
+    bool isEquality() const { return lowerBound != nullptr && lowerBound == upperBound; }
+    std::string keyToString() const;
+
+    std::unique_ptr<ExtraScanNodeTableInfo> copy() const override {
+        return std::make_unique<SecondaryIndexScanInfo>(indexID, indexName, lowerBound,
+            upperBound);
+    }
+};
+
 class LogicalScanNodeTable final : public LogicalOperator {
     static constexpr LogicalOperatorType type_ = LogicalOperatorType::SCAN_NODE_TABLE;
     static constexpr LogicalScanNodeTableType defaultScanType = LogicalScanNodeTableType::SCAN;
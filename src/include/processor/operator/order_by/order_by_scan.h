@@ -58,6 +58,8 @@ public:
 
     double getProgress(ExecutionContext* context) const override;
 
+    SortSharedState* getSharedState() const { return sharedState.get(); }
+
 private:
     std::vector<DataPos> outVectorPos;
     std::unique_ptr<OrderByScanLocalState> localState;
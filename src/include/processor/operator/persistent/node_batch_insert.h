@@ -18,6 +18,7 @@ class Transaction;
 } // namespace transaction
 
 namespace processor {
+class SortSharedState;
 struct ExecutionContext;
 
 struct NodeBatchInsertPrintInfo final : OPPrintInfo {
@@ -73,6 +74,8 @@ struct NodeBatchInsertSharedState final : BatchInsertSharedState {
 
     TableFunctionCallSharedState* readerSharedState;
     HashAggregateSharedState* distinctSharedState;
+    // Set when rows are sorted by a cluster key before insertion.
+    SortSharedState* sortSharedState;
 
     std::vector<common::column_id_t> mainDataColumns;
 
@@ -85,7 +88,7 @@ struct NodeBatchInsertSharedState final : BatchInsertSharedState {
         storage::MemoryManager* mm)
         : BatchInsertSharedState{table, std::move(fTable), wal, mm}, pkColumnID{pkColumnID},
           pkType{std::move(pkType)}, globalIndexBuilder(std::nullopt), readerSharedState{nullptr},
-          distinctSharedState{nullptr}, sharedNodeGroup{nullptr} {}
+          distinctSharedState{nullptr}, sortSharedState{nullptr}, sharedNodeGroup{nullptr} {}
 
     void initPKIndex(const ExecutionContext* context);
 };
@@ -51,6 +51,7 @@ enum class PhysicalOperatorType : uint8_t {
     RESULT_COLLECTOR,
     SCAN_NODE_TABLE,
     SCAN_REL_TABLE,
+    SECONDARY_INDEX_SCAN_NODE_TABLE,
     SEMI_MASKER,
     SET_PROPERTY,
     SKIP,
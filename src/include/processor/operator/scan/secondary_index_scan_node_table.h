@@ -0,0 +1,97 @@
+#pragma once
+
+#include <span>
+
+#include "expression_evaluator/expression_evaluator.h"
+#include "processor/operator/scan/scan_node_table.h"
+
+namespace kuzu {
+namespace processor {
+
+struct SecondaryIndexScanPrintInfo final : OPPrintInfo {
+    binder::expression_vector expressions;
+    std::string indexName;
+    std::string key;
+
+    SecondaryIndexScanPrintInfo(binder::expression_vector expressions, std::string indexName,
+        std::string key)
+        : expressions{std::move(expressions)}, indexName{std::move(indexName)},
+          key{std::move(key)} {}
+
+    std::string toString() const override;
+
+    std::unique_ptr<OPPrintInfo> copy() const override {
+        return std::unique_ptr<SecondaryIndexScanPrintInfo>(new SecondaryIndexScanPrintInfo(*this));
+    }
+
+private:
+    SecondaryIndexScanPrintInfo(const SecondaryIndexScanPrintInfo& other)
+        : OPPrintInfo{other}, expressions{other.expressions}, indexName{other.indexName},
+          key{other.key} {}
+};
+
+// The index is looked up once, by the first thread asking for an offset.
+struct SecondaryIndexScanSharedState {
+    std::mutex mtx;
+
+    bool initialized = false;
+    std::vector<common::offset_t> offsets;
+    common::idx_t cursor = 0;
+
+    // Hands out the next sorted offsets of a single node group, at most DEFAULT_VECTOR_CAPACITY of
+    // them. Returns an empty span once all offsets have been handed out.
+    std::span<const common::offset_t> getNextBatch(
+        const std::function<void(std::vector<common::offset_t>&)>& lookupFunc);
+};
+
+// Scans the nodes of a single table whose indexed property may be between the bounds. A missing
+// bound evaluator leaves that side of the range open. The index returns candidates only, so a
+// filter on the property is expected above this operator.
+class SecondaryIndexScanNodeTable final : public ScanTable {
+    static constexpr PhysicalOperatorType type_ =
+        PhysicalOperatorType::SECONDARY_INDEX_SCAN_NODE_TABLE;
+
+public:
+    SecondaryIndexScanNodeTable(ScanTableInfo info, ScanNodeTableInfo nodeInfo,
+        common::oid_t indexID, std::unique_ptr<evaluator::ExpressionEvaluator> lowerBoundEvaluator,
+        std::unique_ptr<evaluator::ExpressionEvaluator> upperBoundEvaluator,
+        std::shared_ptr<SecondaryIndexScanSharedState> sharedState, uint32_t id,
+        std::unique_ptr<OPPrintInfo> printInfo)
+        : ScanTable{type_, std::move(info), id, std::move(printInfo)},
+          nodeInfo{std::move(nodeInfo)}, indexID{indexID},
+          lowerBoundEvaluator{std::move(lowerBoundEvaluator)},
+          upperBoundEvaluator{std::move(upperBoundEvaluator)},
+          sharedState{std::move(sharedState)} {}
+
+    bool isSource() const override { return true; }
+
+    void initLocalStateInternal(ResultSet*, ExecutionContext*) override;
+
+    bool getNextTuplesInternal(ExecutionContext* context) override;
+
+    std::unique_ptr<PhysicalOperator> clone() override {
+        return std::make_unique<SecondaryIndexScanNodeTable>(info.copy(), nodeInfo.copy(),
+            indexID, lowerBoundEvaluator ? lowerBoundEvaluator->clone() : nullptr,
+            upperBoundEvaluator ? upperBoundEvaluator->clone() : nullptr, sharedState, id,
+            printInfo->copy());
+    }
+
+private:
+    void initVectors(storage::TableScanState& state, const ResultSet& resultSet) const override;
+
+    // Evaluates the bound and returns its vector, or nullptr if there is no such bound. Sets
+    // isNull if the bound evaluates to null.
+    static common::ValueVector* evaluateBound(evaluator::ExpressionEvaluator* evaluator,
+        bool& isNull);
+
+private:
+    ScanNodeTableInfo nodeInfo;
+    common::oid_t indexID;
+    std::unique_ptr<evaluator::ExpressionEvaluator> lowerBoundEvaluator;
+    std::unique_ptr<evaluator::ExpressionEvaluator> upperBoundEvaluator;
+    std::shared_ptr<SecondaryIndexScanSharedState> sharedState;
+    std::vector<common::sel_t> visiblePositions;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -179,7 +179,8 @@ class BufferManager {
 
 public:
     BufferManager(const std::string& databasePath, const std::string& spillToDiskPath,
-        uint64_t bufferPoolSize, uint64_t maxDBSize, common::VirtualFileSystem* vfs, bool readOnly);
+        uint64_t bufferPoolSize, uint64_t maxDBSize, common::VirtualFileSystem* vfs, bool readOnly,
+        bool useHugePages = false, common::NumaPolicy numaPolicy = common::NumaPolicy::DEFAULT);
     ~BufferManager();
 
     // Currently, these functions are specifically used only for WAL files.
@@ -197,6 +198,7 @@ public:
     }
 
     uint64_t getUsedMemory() const { return usedMemory; }
+    std::vector<FileHandleStats> getFileHandleStats() const;
 
     void getSpillerOrSkip(std::function<void(Spiller&)> func) {
         if (spiller) {
@@ -208,9 +210,13 @@ private:
     uint8_t* pin(FileHandle& fileHandle, common::page_idx_t pageIdx,
         PageReadPolicy pageReadPolicy = PageReadPolicy::READ_PAGE);
     void optimisticRead(FileHandle& fileHandle, common::page_idx_t pageIdx,
-        const std::function<void(uint8_t*)>& func);
+        const std::function<void(uint8_t*)>& func,
+        PageAccessHint pageAccessHint = PageAccessHint::DEFAULT);
     // The function assumes that the requested page is already pinned.
     void unpin(FileHandle& fileHandle, common::page_idx_t pageIdx);
+    // Reads the evicted pages of the given range into their frames ahead of pinning them.
+    void prefetchPages(FileHandle& fileHandle, common::page_idx_t startPageIdx,
+        common::page_idx_t numPages);
     uint8_t* getFrame(FileHandle& fileHandle, common::page_idx_t pageIdx) const {
         return vmRegions[fileHandle.getPageSizeClass()]->getFrame(fileHandle.getFrameIdx(pageIdx));
     }
@@ -3,6 +3,7 @@
 #include <mutex>
 
 #include "common/constants.h"
+#include "common/enums/numa_policy.h"
 #include "common/types/types.h"
 
 namespace kuzu {
@@ -13,16 +14,26 @@ namespace storage {
 // Each FileHandle should grab a frame group each time when they add a new file page group (see
 // `FileHandle::addNewPageGroupWithoutLock`). In this way, each file page group uniquely
 // corresponds to a frame group, thus, a page also uniquely corresponds to a frame in a VMRegion.
+//
+// On Linux, the region can optionally be backed by transparent huge pages and be given a NUMA
+// memory policy. Both only affect how the kernel backs the region with physical memory, so they
+// are applied on a best-effort basis: if the kernel does not support them, the region falls back
+// to regular pages and the default policy.
 class VMRegion {
     friend class BufferManager;
 
 public:
-    explicit VMRegion(common::PageSizeClass pageSizeClass, uint64_t maxRegionSize);
+    // Size of a transparent huge page. With huge pages enabled, the region is aligned to it.
+    static constexpr uint64_t HUGE_PAGE_SIZE = static_cast<uint64_t>(1) << 21; // (2MB)
+
+    explicit VMRegion(common::PageSizeClass pageSizeClass, uint64_t maxRegionSize,
+        bool useHugePages = false, common::NumaPolicy numaPolicy = common::NumaPolicy::DEFAULT);
     ~VMRegion();
 
     common::frame_group_idx_t addNewFrameGroup();
 
-    // Use `MADV_DONTNEED` to release physical memory associated with this frame.
+    // Use `MADV_DONTNEED` to release physical memory associated with this frame. If the frame is
+    // part of a huge page, the kernel splits the huge page first.
     void releaseFrame(common::frame_idx_t frameIdx) const;
 
     // Returns true if the memory address is within the reserved virtual memory region
@@ -33,17 +44,27 @@ public:
         return region + (static_cast<std::uint64_t>(frameIdx) * frameSize);
     }
 
+    // Whether the kernel accepted the huge page advice and the NUMA policy for the region.
+    bool isHugePageBacked() const { return hugePageBacked; }
+    bool hasNumaPolicyApplied() const { return numaPolicyApplied; }
+
 private:
     inline uint64_t getMaxRegionSize() const {
         return maxNumFrameGroups * frameSize * common::StorageConstants::PAGE_GROUP_SIZE;
     }
 
+    void reserveRegion(bool useHugePages);
+    void adviseHugePages();
+    void applyNumaPolicy(common::NumaPolicy numaPolicy);
+
 private:
     std::mutex mtx;
     uint8_t* region;
     uint32_t frameSize;
     uint64_t numFrameGroups;
     uint64_t maxNumFrameGroups;
+    bool hugePageBacked;
+    bool numaPolicyApplied;
 };
 
 } // namespace storage
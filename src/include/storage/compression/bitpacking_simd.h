@@ -0,0 +1,45 @@
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <string_view>
+
+namespace kuzu::storage {
+
+// Instruction sets which have bit-unpacking kernels, in increasing order of preference
+enum class SIMDLevel : uint8_t {
+    SCALAR = 0,
+    SSE4_1 = 1,
+    AVX2 = 2,
+    AVX512 = 3,
+};
+
+template<typename T>
+concept SIMDUnpackType = std::same_as<T, uint32_t> || std::same_as<T, uint64_t>;
+
+// Unpacks consecutive fastpfor chunks of 32 values, each bitpacked into bitWidth 32-bit words, into
+// 32 or 64-bit integers. The kernel is chosen at runtime from the instruction sets supported by the
+// CPU. Bit widths above MAX_SIMD_BIT_WIDTH, and CPUs (or compilers) without SIMD support fall back
+// to the scalar fastpfor kernels.
+struct SIMDBitUnpacking {
+    static constexpr uint64_t CHUNK_SIZE = 32;
+    // The SIMD kernels read each value from the 4 bytes starting at the byte containing its first
+    // bit, so the value can be at most 32 - 7 bits wide.
+    static constexpr uint8_t MAX_SIMD_BIT_WIDTH = 25;
+
+    // Returns the best level supported by the CPU, which is detected once
+    static SIMDLevel getSupportedLevel();
+    static bool isSupported(SIMDLevel level);
+    static std::string_view getLevelName(SIMDLevel level);
+
+    template<SIMDUnpackType T>
+    static void unpack(const uint8_t* in, T* out, uint64_t numChunks, uint8_t bitWidth) {
+        unpack(in, out, numChunks, bitWidth, getSupportedLevel());
+    }
+    // The level must be supported by the CPU
+    template<SIMDUnpackType T>
+    static void unpack(const uint8_t* in, T* out, uint64_t numChunks, uint8_t bitWidth,
+        SIMDLevel level);
+};
+
+} // namespace kuzu::storage
@@ -22,6 +22,7 @@ class NullMask;
 
 namespace storage {
 class ColumnChunkData;
+class FSSTSymbolTable;
 
 struct PageCursor;
 
@@ -98,6 +99,19 @@ std::pair<std::optional<StorageValue>, std::optional<StorageValue>> getMinMaxSto
     const uint8_t* data, uint64_t offset, uint64_t numValues, common::PhysicalTypeID physicalType,
     const common::NullMask* nullMask, bool valueRequiredIfUnsupported = false);
 
+// An inclusive range of values of an integral physical type. Constant comparisons on a column are
+// narrowed to such a range, which can then be checked directly against the compressed values.
+struct StorageValueRange {
+    common::PhysicalTypeID physicalType;
+    StorageValue min;
+    StorageValue max;
+
+    // Returns nullopt if the physical type isn't supported
+    static std::optional<StorageValueRange> getFullRange(common::PhysicalTypeID physicalType);
+
+    bool isEmpty() const { return min.gt(max, physicalType); }
+};
+
 // Returns the size of the data type in bytes
 uint32_t getDataTypeSizeInChunk(const common::LogicalType& dataType);
 uint32_t getDataTypeSizeInChunk(const common::PhysicalTypeID& dataType);
@@ -110,6 +124,15 @@ enum class CompressionType : uint8_t {
     BOOLEAN_BITPACKING = 2,
     CONSTANT = 3,
     ALP = 4,
+    // Bytes are stored as is, but they are the FSST encoded string data of a dictionary, which is
+    // decoded string by string using the symbol table in the FSSTMetadata.
+    FSST = 5,
+    // Deltas between consecutive values bitpacked with a frame of reference, with the first value
+    // of each page stored as is. Only used for non-decreasing integer chunks.
+    DELTA_FOR = 6,
+    // Runs of repeated values, stored in the RLEMetadata instead of in pages. Only used for chunks
+    // with few runs.
+    RLE = 7,
 };
 
 struct ExtraMetadata {
@@ -133,6 +156,36 @@ struct ALPMetadata : ExtraMetadata {
     std::unique_ptr<ExtraMetadata> copy() override;
 };
 
+// used only for the string data of dictionaries
+struct FSSTMetadata : ExtraMetadata {
+    explicit FSSTMetadata(std::shared_ptr<const FSSTSymbolTable> symbolTable)
+        : symbolTable{std::move(symbolTable)} {}
+
+    // The symbol table is immutable, so copies of the metadata (e.g. in scan states) share it.
+    std::shared_ptr<const FSSTSymbolTable> symbolTable;
+
+    void serialize(common::Serializer& serializer) const;
+    static FSSTMetadata deserialize(common::Deserializer& deserializer);
+
+    std::unique_ptr<ExtraMetadata> copy() override;
+};
+
+// used only for run-length encoded chunks
+struct RLEMetadata : ExtraMetadata {
+    // Exclusive end offset of each run in the chunk, in increasing order, and the value of the run
+    std::vector<uint64_t> runEnds;
+    std::vector<StorageValue> runValues;
+
+    // Returns the index of the run containing the value at the given offset. Offsets past the end
+    // of the last run belong to the last run.
+    uint64_t findRun(common::offset_t offset) const;
+
+    void serialize(common::Serializer& serializer) const;
+    static RLEMetadata deserialize(common::Deserializer& deserializer);
+
+    std::unique_ptr<ExtraMetadata> copy() override;
+};
+
 struct InPlaceUpdateLocalState {
     struct FloatState {
         size_t newExceptionCount;
@@ -168,6 +221,10 @@ struct CompressionMetadata {
     static size_t getChildCount(CompressionType compressionType);
 
     inline bool isConstant() const { return compression == CompressionType::CONSTANT; }
+    // Constant and run-length encoded chunks are stored entirely in the metadata and have no pages
+    inline bool isStoredInMetadata() const {
+        return compression == CompressionType::CONSTANT || compression == CompressionType::RLE;
+    }
     const CompressionMetadata& getChild(common::offset_t idx) const;
 
     // accessors for additionalMetadata
@@ -185,6 +242,16 @@ struct CompressionMetadata {
     inline ALPMetadata* floatMetadata() {
         return common::ku_dynamic_cast<ALPMetadata*>(getExtraMetadata());
     }
+    // Null if the data isn't FSST encoded
+    inline const FSSTMetadata* fsstMetadata() const {
+        if (compression != CompressionType::FSST) {
+            return nullptr;
+        }
+        return common::ku_dynamic_cast<const FSSTMetadata*>(getExtraMetadata());
+    }
+    inline const RLEMetadata* rleMetadata() const {
+        return common::ku_dynamic_cast<const RLEMetadata*>(getExtraMetadata());
+    }
 
     void serialize(common::Serializer& serializer) const;
     static CompressionMetadata deserialize(common::Deserializer& deserializer);
@@ -385,6 +452,13 @@ public:
         const std::optional<common::NullMask>& nullMask = std::nullopt,
         uint64_t nullMaskOffset = 0);
 
+    // Sets the bits of matches, starting at posInMatches, of the values which are within [min,
+    // max]. Unless values have to be sign extended, the bitpacked values are compared to the range
+    // shifted by the frame of reference instead of being decompressed.
+    void filterFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint64_t* matches,
+        uint64_t posInMatches, uint64_t numValues, const CompressionMetadata& metadata, T min,
+        T max) const;
+
     CompressionType getCompressionType() const override {
         return CompressionType::INTEGER_BITPACKING;
     }
@@ -472,6 +546,29 @@ public:
         uint32_t startPosInResult, uint64_t numValuesToRead, const CompressionMetadata& metadata);
 };
 
+// Evaluates a range on the values read instead of copying them, setting the bits of the values
+// within the range in the result, which is a bitmask. Constant, run-length encoded, bitpacked and
+// uncompressed values are compared without being decompressed.
+class FilterCompressedValuesFromPage : public CompressedFunctor {
+public:
+    FilterCompressedValuesFromPage(const common::LogicalType& logicalType,
+        const StorageValueRange& range)
+        : CompressedFunctor(logicalType), range{range}, readFunc{logicalType} {}
+    FilterCompressedValuesFromPage(const FilterCompressedValuesFromPage&) = default;
+
+    void operator()(const uint8_t* frame, PageCursor& pageCursor, uint8_t* result,
+        uint32_t startPosInResult, uint64_t numValuesToRead, const CompressionMetadata& metadata);
+
+private:
+    template<std::integral T>
+    void filterValues(const uint8_t* frame, PageCursor& pageCursor, uint64_t* matches,
+        uint32_t startPosInResult, uint64_t numValuesToRead, const CompressionMetadata& metadata);
+
+private:
+    StorageValueRange range;
+    ReadCompressedValuesFromPage readFunc;
+};
+
 class WriteCompressedValuesToPage : public CompressedFunctor {
 public:
     explicit WriteCompressedValuesToPage(const common::LogicalType& logicalType)
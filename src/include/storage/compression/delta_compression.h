@@ -0,0 +1,70 @@
+#pragma once
+
+#include <optional>
+#include <span>
+
+#include "storage/compression/compression.h"
+#include <concepts>
+
+namespace kuzu {
+namespace storage {
+
+template<typename T>
+concept DeltaForType = std::integral<T> && !std::same_as<T, bool>;
+
+// Delta encoding combined with frame of reference bitpacking, for non-decreasing integer columns
+// such as CSR offsets or sorted neighbour IDs. The differences between consecutive values are
+// usually much smaller than the range of the values themselves.
+//
+// Values are stored in blocks of BLOCK_SIZE values. Each block starts with the uncompressed value
+// of its first element (the anchor), followed by the bitpacked deltas of all values in the block,
+// so any value can be reconstructed from at most BLOCK_SIZE deltas. The last block of a page is
+// padded to the full block size. The deltas are bitpacked by IntegerBitpacking using the metadata
+// of the only child of the DELTA_FOR compression metadata, whose min and max are the smallest and
+// largest delta.
+//
+// Updating a value changes the deltas of its neighbours, so DELTA_FOR chunks are never updated in
+// place; they are rewritten out of place instead.
+template<DeltaForType T>
+class DeltaForCompression final : public CompressionAlg {
+    using U = std::make_unsigned_t<T>;
+
+public:
+    static constexpr common::idx_t DELTA_CHILD_IDX = 0;
+    // A multiple of the bitpacking chunk size, so that the deltas of each block fill whole bytes.
+    static constexpr uint64_t BLOCK_SIZE = 128;
+
+public:
+    DeltaForCompression() = default;
+    DeltaForCompression(const DeltaForCompression&) = default;
+
+    // Returns DELTA_FOR metadata if the values are non-decreasing and storing their deltas fits
+    // more values per page than the given frame of reference (bitpacking) metadata.
+    static std::optional<CompressionMetadata> analyze(std::span<const T> values,
+        const CompressionMetadata& forMetadata);
+
+    static uint64_t numValues(uint64_t dataSize, const CompressionMetadata& metadata);
+
+    void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
+        uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
+        const CompressionMetadata& metadata, const common::NullMask* nullMask) const override;
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const CompressionMetadata& metadata) const override;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues, const CompressionMetadata& metadata) const override;
+
+    CompressionType getCompressionType() const override { return CompressionType::DELTA_FOR; }
+
+    static uint8_t getDeltaBitWidth(const CompressionMetadata& metadata);
+
+private:
+    static uint64_t getBlockSizeInBytes(uint8_t bitWidth) {
+        return sizeof(T) + BLOCK_SIZE * bitWidth / 8;
+    }
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace storage {
+
+// A symbol table for Fast Static Symbol Table (FSST) string compression, as described in
+// "FSST: Fast Random Access String Compression" (Boncz et al., VLDB 2020).
+//
+// The table maps up to 255 one-byte codes to symbols of 1 to 8 bytes. A string is encoded by
+// greedily replacing the longest matching symbol with its code. Bytes that are not covered by any
+// symbol are written as ESCAPE_CODE followed by the literal byte, so every string can be encoded
+// and the encoded size is at most twice the original size. Each string is encoded independently,
+// which keeps random access to single strings cheap.
+class FSSTSymbolTable {
+public:
+    static constexpr uint8_t ESCAPE_CODE = 255;
+    static constexpr uint16_t MAX_NUM_SYMBOLS = 255;
+    static constexpr uint8_t MAX_SYMBOL_LENGTH = 8;
+    // Upper bound of the encoded size of a string of the given length.
+    static constexpr uint64_t getMaxEncodedLength(uint64_t length) { return 2 * length; }
+
+    FSSTSymbolTable() : numSymbols{0}, symbols{}, symbolLengths{} {}
+
+    // Builds a symbol table that compresses the given sample of strings well. The sample should
+    // be a small (e.g. 16KB), representative subset of the strings that are going to be encoded.
+    static FSSTSymbolTable train(const std::vector<std::string_view>& sample);
+
+    uint16_t getNumSymbols() const { return numSymbols; }
+
+    // Encodes str into dst, which must have room for getMaxEncodedLength(str.size()) bytes.
+    // Returns the number of bytes written.
+    uint64_t encode(std::string_view str, uint8_t* dst) const;
+    // Decodes numBytes encoded bytes from src into dst, which must have room for
+    // getDecodedLength(src, numBytes) bytes. Returns the number of bytes written.
+    uint64_t decode(const uint8_t* src, uint64_t numBytes, uint8_t* dst) const;
+    uint64_t getDecodedLength(const uint8_t* src, uint64_t numBytes) const;
+
+    void serialize(common::Serializer& serializer) const;
+    static FSSTSymbolTable deserialize(common::Deserializer& deserializer);
+
+private:
+    void addSymbol(std::string_view symbol);
+    // Must be called after all symbols have been added.
+    void buildIndex();
+    // Returns the code of the longest symbol that is a prefix of str, or ESCAPE_CODE if none.
+    uint8_t findLongestSymbol(std::string_view str) const;
+
+private:
+    uint16_t numSymbols;
+    // Symbols are stored little-endian in the low bytes of a 64-bit word.
+    std::array<uint64_t, MAX_NUM_SYMBOLS> symbols;
+    std::array<uint8_t, MAX_NUM_SYMBOLS> symbolLengths;
+    // Codes of the symbols starting with each byte, ordered from the longest to the shortest.
+    std::array<std::vector<uint8_t>, 256> codesByFirstByte;
+};
+
+} // namespace storage
+} // namespace kuzu
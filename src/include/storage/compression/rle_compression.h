@@ -0,0 +1,76 @@
+#pragma once
+
+#include <algorithm>
+#include <optional>
+
+#include "storage/compression/compression.h"
+
+namespace kuzu {
+namespace storage {
+
+// Run-length encoding for chunks made of a few runs of repeated values, e.g. low-cardinality
+// properties loaded in clustered order, or the null masks of mostly null optional properties.
+// The runs are kept in the RLEMetadata of the chunk's compression metadata, so like CONSTANT
+// chunks, RLE chunks have no pages, and reading a range of values fills it run by run.
+//
+// RLE chunks are never updated in place; they are rewritten out of place instead.
+class RunLengthEncoding final : public CompressionAlg {
+public:
+    // Each run takes 24 bytes of metadata, which is kept in memory for every chunk
+    static constexpr uint64_t MAX_NUM_RUNS = 64;
+
+    explicit RunLengthEncoding(common::PhysicalTypeID physicalType)
+        : physicalType{physicalType} {}
+    RunLengthEncoding(const RunLengthEncoding&) = default;
+
+    // Returns RLE metadata if the values form at most MAX_NUM_RUNS runs. Booleans are read from
+    // their bitpacked in-memory representation.
+    static std::optional<CompressionMetadata> analyze(const uint8_t* data, uint64_t numValues,
+        common::PhysicalTypeID physicalType, StorageValue min, StorageValue max);
+
+    // Calls func(runValue, posInRange, numValuesInRun) for each run overlapping the numValues
+    // values starting at startOffset in the chunk.
+    template<typename Func>
+    static void forEachRun(const CompressionMetadata& metadata, common::offset_t startOffset,
+        uint64_t numValues, Func&& func) {
+        const auto* rleMetadata = metadata.rleMetadata();
+        auto run = rleMetadata->findRun(startOffset);
+        uint64_t pos = 0;
+        while (pos < numValues) {
+            const auto runEnd = run + 1 == rleMetadata->runEnds.size() ?
+                                    startOffset + numValues :
+                                    rleMetadata->runEnds[run];
+            const auto numValuesInRun = std::min(runEnd - (startOffset + pos), numValues - pos);
+            func(rleMetadata->runValues[run], pos, numValuesInRun);
+            pos += numValuesInRun;
+            run++;
+        }
+    }
+
+    // Shouldn't be used, there's a special case when flushing which skips chunks stored in
+    // metadata
+    uint64_t compressNextPage(const uint8_t*&, uint64_t, uint8_t*, uint64_t,
+        const struct CompressionMetadata&) const override {
+        return 0;
+    }
+
+    void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
+        uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
+        const CompressionMetadata& metadata, const common::NullMask* nullMask) const override;
+
+    void decompressFromPage(const uint8_t* /*srcBuffer*/, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues, const CompressionMetadata& metadata) const override;
+
+    // Same as decompressFromPage, except that booleans are written bitpacked, as they are stored
+    // in column chunks.
+    void copyFromPage(const uint8_t* /*srcBuffer*/, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues, const CompressionMetadata& metadata) const;
+
+    CompressionType getCompressionType() const override { return CompressionType::RLE; }
+
+private:
+    common::PhysicalTypeID physicalType;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -7,5 +7,10 @@ namespace storage {
 
 enum class PageReadPolicy : uint8_t { READ_PAGE = 0, DONT_READ_PAGE = 1 };
 
+// Pages read with the STREAMING hint, e.g. by sequential scans, are left marked in the eviction
+// queue instead of getting a second chance. Thus, a large scan evicts its own pages first, rather
+// than the pages that are frequently accessed by other queries.
+enum class PageAccessHint : uint8_t { DEFAULT = 0, STREAMING = 1 };
+
 } // namespace storage
 } // namespace kuzu
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cmath>
 #include <cstdint>
 #include <cstring>
@@ -38,6 +39,15 @@ namespace storage {
 
 class ShadowFile;
 class BufferManager;
+// Buffer pool counters of a file since the database was opened.
+struct FileHandleStats {
+    std::string path;
+    common::page_idx_t numPages = 0;
+    uint64_t numPageHits = 0;
+    uint64_t numPageMisses = 0;
+    uint64_t numPrefetchedPages = 0;
+};
+
 class FileHandle {
 public:
     friend class BufferManager;
@@ -64,9 +74,12 @@ public:
 
     uint8_t* pinPage(common::page_idx_t pageIdx, PageReadPolicy readPolicy);
     void optimisticReadPage(common::page_idx_t pageIdx,
-        const std::function<void(uint8_t*)>& readOp);
+        const std::function<void(uint8_t*)>& readOp,
+        PageAccessHint pageAccessHint = PageAccessHint::DEFAULT);
     // The function assumes that the requested page is already pinned.
     void unpinPage(common::page_idx_t pageIdx);
+    // Hint that the pages in [startPageIdx, startPageIdx + numPages) will be read soon.
+    void prefetchPages(common::page_idx_t startPageIdx, common::page_idx_t numPages);
 
     // This function assumes the page is already LOCKED.
     void setLockedPageDirty(common::page_idx_t pageIdx) {
@@ -81,6 +94,8 @@ public:
     common::page_idx_t addNewPage();
     common::page_idx_t addNewPages(common::page_idx_t numNewPages);
     void removePageIdxAndTruncateIfNecessary(common::page_idx_t pageIdx);
+    // Removes all pages starting from numPagesToKeep from the buffer manager and the file on disk.
+    void truncate(common::page_idx_t numPagesToKeep);
     void removePageFromFrameIfNecessary(common::page_idx_t pageIdx);
     void flushAllDirtyPagesInFrames();
 
@@ -111,6 +126,8 @@ public:
         return isLargePaged() ? common::TEMP_PAGE_SIZE : common::PAGE_SIZE;
     }
 
+    FileHandleStats getStats() const;
+
     void loadFreeChunkMap(common::Deserializer& deserializer) const;
     FreeChunkMap &getFreeChunkMap() const { return *freeChunkMap; }
     void checkpoint(common::Serializer& serializer) const;
@@ -168,6 +185,10 @@ private:
     // and left at the default which won't increase access cost for the frame groups until 16TB of
     // data has been written
     common::ConcurrentVector<common::page_group_idx_t> frameGroupIdxes;
+    // Counters updated by the buffer manager. A hit is an access to a page that is in its frame.
+    std::atomic<uint64_t> numPageHits;
+    std::atomic<uint64_t> numPageMisses;
+    std::atomic<uint64_t> numPrefetchedPages;
 
     std::unique_ptr<FreeChunkMap> freeChunkMap;
 };
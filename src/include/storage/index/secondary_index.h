@@ -0,0 +1,116 @@
+#pragma once
+
+#include <shared_mutex>
+
+#include "common/enums/secondary_index_type.h"
+#include "common/types/types.h"
+#include "storage/storage_structure/disk_array.h"
+
+namespace kuzu {
+namespace common {
+class ValueVector;
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace storage {
+
+// A non-unique index from the values of a node table column to node offsets.
+//
+// Each value is reduced to a 64-bit key: a hash of it for HASH indexes, or an order-preserving
+// prefix of it for ORDERED indexes. Different values may share a key, and entries of updated or
+// deleted nodes are only removed when their run is rewritten at checkpoint, so lookups return a
+// superset of the matching nodes and callers must check the values and visibility of the returned
+// nodes.
+//
+// Entries are kept in runs sorted by key, with run sizes roughly doubling from the newest to the
+// oldest one, so a lookup is a binary search in a logarithmic number of runs and each entry is
+// rewritten a logarithmic number of times. New entries are added to in-memory runs. At checkpoint
+// they are merged with the newest runs of a DiskArray in the data file.
+class SecondaryIndex {
+public:
+    struct Entry {
+        uint64_t key;
+        common::offset_t offset;
+
+        auto operator<=>(const Entry&) const = default;
+    };
+
+    // A sorted run of entries in the DiskArray.
+    struct DiskRun {
+        uint64_t startIdx;
+        uint64_t numEntries;
+    };
+
+    SecondaryIndex(common::oid_t indexID, common::SecondaryIndexType indexType,
+        std::string propertyName, common::PhysicalTypeID keyType, common::column_id_t columnID,
+        FileHandle& dataFH, ShadowFile* shadowFile, const DiskArrayHeader& header = {},
+        std::vector<DiskRun> diskRuns = {});
+
+    static bool isKeyTypeSupported(common::PhysicalTypeID keyType);
+
+    common::oid_t getIndexID() const { return indexID; }
+    common::SecondaryIndexType getIndexType() const { return indexType; }
+    const std::string& getPropertyName() const { return propertyName; }
+    common::column_id_t getColumnID() const { return columnID; }
+    void setColumnID(common::column_id_t columnID_) { columnID = columnID_; }
+
+    // Returns the key the value at the given position is indexed under.
+    uint64_t getKey(const common::ValueVector& keyVector, common::sel_t pos) const;
+    // Returns the inclusive range of keys which the values between the single selected values of
+    // the bound vectors are indexed under. A null bound vector leaves that side unbounded, which is
+    // only allowed for ORDERED indexes. The selected values must not be null.
+    std::pair<uint64_t, uint64_t> getKeyRange(const common::ValueVector* lowerBoundVector,
+        const common::ValueVector* upperBoundVector) const;
+
+    // Appends an entry for each selected non-null value of keyVector, pointing to the node at the
+    // same position of nodeIDVector.
+    void appendEntries(const common::ValueVector& nodeIDVector,
+        const common::ValueVector& keyVector, std::vector<Entry>& entries) const;
+    void insert(const common::ValueVector& nodeIDVector, const common::ValueVector& keyVector);
+    void insert(std::vector<Entry> entries);
+
+    // Appends the offsets of all entries with the given key to result, in no particular order.
+    void lookup(uint64_t key, std::vector<common::offset_t>& result);
+    // Appends the offsets of all entries with keys in [lowKey, highKey] to result, in no particular
+    // order. Only meaningful for ORDERED indexes.
+    void lookupRange(uint64_t lowKey, uint64_t highKey, std::vector<common::offset_t>& result);
+    // Returns the number of entries with keys in [lowKey, highKey] without reading them.
+    uint64_t countRange(uint64_t lowKey, uint64_t highKey);
+    uint64_t getNumEntries();
+
+    // Merges the in-memory runs into the DiskArray. The entries of the merged runs which are not
+    // in liveEntries, the sorted entries of the current values of all nodes, are dropped.
+    void checkpoint(const std::vector<Entry>& liveEntries);
+    // Returns the pages of the DiskArray, which can be freed once the index is dropped.
+    std::vector<common::page_idx_t> getPageIdxs() const;
+
+    void serialize(common::Serializer& serializer) const;
+    // The column ID isn't serialized, as it changes when the table's columns are vacuumed.
+    static std::unique_ptr<SecondaryIndex> deserialize(common::Deserializer& deserializer,
+        FileHandle& dataFH, ShadowFile* shadowFile);
+
+private:
+    void insertRunNoLock(std::vector<Entry> run);
+    // Returns the index of the first entry of the run with a key not less than the given one.
+    uint64_t lowerBound(const DiskRun& run, uint64_t key);
+
+private:
+    common::oid_t indexID;
+    common::SecondaryIndexType indexType;
+    std::string propertyName;
+    common::PhysicalTypeID keyType;
+    common::column_id_t columnID;
+
+    std::shared_mutex mtx;
+    // Runs which have not been checkpointed yet, from the oldest to the newest.
+    std::vector<std::vector<Entry>> memoryRuns;
+    // From the oldest to the newest. The runs are stored one after another in the DiskArray.
+    std::vector<DiskRun> diskRuns;
+    DiskArrayHeader headerForReadTrx;
+    DiskArrayHeader headerForWriteTrx;
+    std::unique_ptr<DiskArray<Entry>> diskArray;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "binder/expression/expression.h"
 #include "common/cast.h"
 #include "common/enums/zone_map_check_result.h"
@@ -8,6 +10,8 @@ namespace kuzu {
 namespace storage {
 
 struct CompressionMetadata;
+struct StorageValueRange;
+class StringZoneMap;
 
 class ColumnPredicate;
 class KUZU_API ColumnPredicateSet {
@@ -21,6 +25,11 @@ public:
     bool isEmpty() const { return predicates.empty(); }
 
     common::ZoneMapCheckResult checkZoneMap(const CompressionMetadata& metadata);
+    common::ZoneMapCheckResult checkZoneMap(const StringZoneMap& zoneMap) const;
+
+    // Returns the range of values of a column of the given physical type which may satisfy all
+    // predicates, or nullopt if the predicates don't narrow it down.
+    std::optional<StorageValueRange> getValueRange(common::PhysicalTypeID physicalType) const;
 
     std::string toString() const;
 
@@ -39,6 +48,13 @@ public:
     virtual ~ColumnPredicate() = default;
 
     virtual common::ZoneMapCheckResult checkZoneMap(const CompressionMetadata& metadata) const = 0;
+    virtual common::ZoneMapCheckResult checkZoneMap(const StringZoneMap& /*zoneMap*/) const {
+        return common::ZoneMapCheckResult::ALWAYS_SCAN;
+    }
+
+    // Narrows the range to the values which may satisfy the predicate. Predicates which can't be
+    // expressed as a range leave it unchanged.
+    virtual void narrowRange(StorageValueRange& /*range*/) const {}
 
     virtual std::string toString() = 0;
 
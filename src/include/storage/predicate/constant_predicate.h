@@ -15,6 +15,9 @@ public:
           value{std::move(value)} {}
 
     common::ZoneMapCheckResult checkZoneMap(const CompressionMetadata& metadata) const override;
+    common::ZoneMapCheckResult checkZoneMap(const StringZoneMap& zoneMap) const override;
+
+    void narrowRange(StorageValueRange& range) const override;
 
     std::string toString() override;
 
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <mutex>
+#include <optional>
 
 #include "catalog/catalog.h"
+#include "common/enums/free_chunk_policy.h"
 #include "storage/index/hash_index.h"
 #include "storage/wal/shadow_file.h"
 #include "storage/wal/wal.h"
@@ -19,7 +21,8 @@ class DiskArrayCollection;
 class StorageManager {
 public:
     StorageManager(const std::string& databasePath, bool readOnly, const catalog::Catalog& catalog,
-        MemoryManager& memoryManager, bool enableCompression, common::VirtualFileSystem* vfs,
+        MemoryManager& memoryManager, bool enableCompression,
+        std::optional<common::FreeChunkPolicy> freeChunkPolicy, common::VirtualFileSystem* vfs,
         main::ClientContext* context);
 
     ~StorageManager();
@@ -29,6 +32,9 @@ public:
         main::ClientContext* context);
 
     void checkpoint(main::ClientContext& clientContext);
+    // Called once the checkpoint is durable. Makes the space recycled during the checkpoint reusable
+    // and truncates free pages at the end of the data file.
+    void finishCheckpoint();
 
     PrimaryKeyIndex* getPKIndex(common::table_id_t tableID);
 
@@ -62,6 +68,10 @@ private:
     void createRdfGraph(common::table_id_t tableID, catalog::RDFGraphCatalogEntry* tableSchema,
         const catalog::Catalog* catalog, main::ClientContext* context);
 
+    // Moves on-disk node column chunks from the end of the data file into free extents closer to its
+    // beginning, so that finishCheckpoint can truncate the file.
+    void compactDataFile(const catalog::Catalog& catalog);
+
 private:
     std::mutex mtx;
     std::string databasePath;
@@ -134,6 +134,9 @@ public:
 
     virtual void checkpoint();
 
+    // Returns the PIPs and array pages of the array as of the last checkpoint.
+    std::vector<common::page_idx_t> getPageIdxs() const;
+
     // Write WriteIterator for making fast bulk changes to the disk array
     // The pages are cached while the elements are stored on the same page
     // Designed for sequential writes, but supports random writes too (at the cost that the page
@@ -303,6 +306,8 @@ public:
     inline void rollbackInMemoryIfNecessary() { diskArray.rollbackInMemoryIfNecessary(); }
     inline void checkpoint() { diskArray.checkpoint(); }
 
+    std::vector<common::page_idx_t> getPageIdxs() const { return diskArray.getPageIdxs(); }
+
     class WriteIterator {
     public:
         explicit WriteIterator(DiskArrayInternal::WriteIterator&& iter) : iter(std::move(iter)) {}
@@ -88,7 +88,7 @@ public:
     void write(const ChunkedNodeGroup& data, common::column_id_t offsetColumnID);
 
     void scan(const transaction::Transaction* transaction, const TableScanState& scanState,
-        const NodeGroupScanState& nodeGroupScanState, common::offset_t rowIdxInGroup,
+        NodeGroupScanState& nodeGroupScanState, common::offset_t rowIdxInGroup,
         common::length_t numRowsToScan) const;
 
     template<ResidencyState SCAN_RESIDENCY_STATE>
@@ -168,6 +168,10 @@ public:
 
     void setUnused(MemoryManager& mm);
 
+private:
+    // Returns true if the zone map of a chunk rules out all values satisfying its predicates
+    bool isSkippedByZoneMaps(const TableScanState& scanState) const;
+
 protected:
     NodeGroupDataFormat format;
     ResidencyState residencyState;
@@ -64,10 +64,19 @@ public:
         ColumnChunkData* columnChunk, common::offset_t startOffset = 0,
         common::offset_t endOffset = common::INVALID_OFFSET);
 
+    // Removes the rows among the numValuesToScan values starting at startOffsetInChunk whose values
+    // are outside the range from selVector, whose positions are relative to startOffsetInChunk.
+    // The range is evaluated on the compressed values. Null values aren't checked, so rows with
+    // nulls may be removed too, which is fine for comparisons as they are never true for nulls.
+    void filter(const ChunkState& state, common::offset_t startOffsetInChunk,
+        common::row_idx_t numValuesToScan, const StorageValueRange& range,
+        common::SelectionVector& selVector);
+
     common::LogicalType& getDataType() { return dataType; }
     const common::LogicalType& getDataType() const { return dataType; }
 
     Column* getNullColumn() const;
+    FileHandle* getDataFH() const { return dataFH; }
 
     std::string getName() const { return name; }
 
@@ -1,11 +1,13 @@
 #pragma once
 
+#include "common/enums/zone_map_check_result.h"
 #include "storage/store/column_chunk_data.h"
 #include "storage/store/update_info.h"
 
 namespace kuzu {
 namespace storage {
 class MemoryManager;
+class ColumnPredicateSet;
 
 struct ChunkCheckpointState {
     std::unique_ptr<ColumnChunkData> chunkData;
@@ -49,6 +51,14 @@ public:
     void initializeScanState(ChunkState& state, Column* column) const;
     void scan(const transaction::Transaction* transaction, const ChunkState& state,
         common::ValueVector& output, common::offset_t offsetInChunk, common::length_t length) const;
+    // Narrows selVector to the rows whose values may be within the range, see Column::filter.
+    // Only persistent chunks without updates are filtered, as they are read from compressed data.
+    void filter(const ChunkState& state, const StorageValueRange& range,
+        common::offset_t offsetInChunk, common::length_t length,
+        common::SelectionVector& selVector) const;
+    // Checks the predicates against the zone map of a persistent string chunk without updates.
+    // Other chunks are always scanned.
+    common::ZoneMapCheckResult checkZoneMap(const ColumnPredicateSet& predicateSet) const;
     template<ResidencyState SCAN_RESIDENCY_STATE>
     void scanCommitted(transaction::Transaction* transaction, ChunkState& chunkState,
         ColumnChunk& output, common::row_idx_t startRow = 0,
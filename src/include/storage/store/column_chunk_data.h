@@ -10,6 +10,7 @@
 #include "common/types/types.h"
 #include "common/vector/value_vector.h"
 #include "storage/compression/compression.h"
+#include "storage/enums/page_read_policy.h"
 #include "storage/enums/residency_state.h"
 #include "storage/store/column_chunk_metadata.h"
 #include "storage/store/column_reader_writer.h"
@@ -34,6 +35,9 @@ struct ChunkState {
     Column* column;
     ColumnChunkMetadata metadata;
     uint64_t numValuesPerPage = UINT64_MAX;
+    PageAccessHint pageAccessHint = PageAccessHint::DEFAULT;
+    // Number of pages from the start of the chunk which were prefetched by a sequential scan.
+    common::page_idx_t numPrefetchedPages = 0;
     std::unique_ptr<ChunkState> nullState;
 
     // Used for struct/list/string columns.
@@ -65,6 +69,7 @@ struct ChunkState {
 
     void resetState() {
         numValuesPerPage = UINT64_MAX;
+        numPrefetchedPages = 0;
         metadata = ColumnChunkMetadata{};
         if (nullState) {
             nullState->resetState();
@@ -147,6 +152,10 @@ public:
         metadata = metadata_;
     }
 
+    // Keeps integer chunks from being flushed with DELTA_FOR compression, which cannot be updated
+    // in place. Used for chunks which are mostly appended to in place, e.g. dictionary offsets.
+    void disableDeltaEncoding();
+
     // Only have side effects on in-memory or temporary chunks.
     virtual void resetToAllNull();
     virtual void resetToEmpty();
@@ -161,6 +170,10 @@ public:
     virtual void flush(FileHandle& dataFH);
 
     virtual std::vector<std::pair<common::page_idx_t, common::page_idx_t>> getAllChunkPhysicInfo();
+    /* Collect this chunk and all its null/child chunks that own pages in the data file */
+    virtual void collectOnDiskChunks(std::vector<ColumnChunkData*>& chunks);
+    /* Copy the pages of this on-disk chunk to newPageIdx and point its metadata there */
+    void relocate(FileHandle& dataFH, common::page_idx_t newPageIdx);
 
     ColumnChunkMetadata flushBuffer(FileHandle* dataFH, common::page_idx_t startPageIdx,
         const ColumnChunkMetadata& metadata) const;
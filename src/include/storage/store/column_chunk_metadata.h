@@ -2,12 +2,16 @@
 
 #include "common/types/types.h"
 #include "storage/compression/compression.h"
+#include "storage/store/string_zone_map.h"
 namespace kuzu::storage {
 struct ColumnChunkMetadata {
     common::page_idx_t pageIdx;
     common::page_idx_t numPages;
     uint64_t numValues;
     CompressionMetadata compMeta;
+    // Only set for persistent string chunks. It is shared by copies of the metadata (e.g. in scan
+    // states), so in-place writes replace it instead of modifying it.
+    std::shared_ptr<const StringZoneMap> stringZoneMap;
 
     void serialize(common::Serializer& serializer) const;
     static ColumnChunkMetadata deserialize(common::Deserializer& deserializer);
@@ -24,10 +28,12 @@ struct ColumnChunkMetadata {
 class GetBitpackingMetadata {
     std::shared_ptr<CompressionAlg> alg;
     const common::LogicalType& dataType;
+    bool enableDeltaEncoding;
 
 public:
-    GetBitpackingMetadata(std::shared_ptr<CompressionAlg> alg, const common::LogicalType& dataType)
-        : alg{std::move(alg)}, dataType{dataType} {}
+    GetBitpackingMetadata(std::shared_ptr<CompressionAlg> alg, const common::LogicalType& dataType,
+        bool enableDeltaEncoding = true)
+        : alg{std::move(alg)}, dataType{dataType}, enableDeltaEncoding{enableDeltaEncoding} {}
 
     GetBitpackingMetadata(const GetBitpackingMetadata& other) = default;
 
@@ -56,4 +62,8 @@ ColumnChunkMetadata uncompressedGetMetadata(std::span<const uint8_t> buffer, uin
 
 ColumnChunkMetadata booleanGetMetadata(std::span<const uint8_t> buffer, uint64_t capacity,
     uint64_t numValues, StorageValue min, StorageValue max);
+
+// Same as booleanGetMetadata, but run-length encodes booleans with few runs
+ColumnChunkMetadata booleanGetCompressedMetadata(std::span<const uint8_t> buffer,
+    uint64_t capacity, uint64_t numValues, StorageValue min, StorageValue max);
 } // namespace kuzu::storage
@@ -79,7 +79,8 @@ public:
         common::offset_t numValues, const write_values_func_t& writeFunc) = 0;
 
     void readFromPage(transaction::Transaction* transaction, common::page_idx_t pageIdx,
-        const std::function<void(uint8_t*)>& readFunc);
+        const std::function<void(uint8_t*)>& readFunc,
+        PageAccessHint pageAccessHint = PageAccessHint::DEFAULT);
 
     void updatePageWithCursor(PageCursor cursor,
         const std::function<void(uint8_t*, common::offset_t)>& writeOp) const;
@@ -1,11 +1,15 @@
 #pragma once
 
+#include <memory>
+#include <optional>
+
 #include "storage/enums/residency_state.h"
 #include "storage/store/column_chunk_data.h"
 
 namespace kuzu {
 namespace storage {
 class MemoryManager;
+class FSSTSymbolTable;
 
 class DictionaryChunk {
 public:
@@ -33,7 +37,10 @@ public:
 
     ColumnChunkData* getStringDataChunk() const { return stringDataChunk.get(); }
     ColumnChunkData* getOffsetChunk() const { return offsetChunk.get(); }
-    void setOffsetChunk(std::unique_ptr<ColumnChunkData> chunk) { offsetChunk = std::move(chunk); }
+    void setOffsetChunk(std::unique_ptr<ColumnChunkData> chunk) {
+        offsetChunk = std::move(chunk);
+        offsetChunk->disableDeltaEncoding();
+    }
     void setStringDataChunk(std::unique_ptr<ColumnChunkData> chunk) {
         stringDataChunk = std::move(chunk);
     }
@@ -50,6 +57,21 @@ public:
 
     void flush(FileHandle& dataFH);
 
+    // String data and offsets of the dictionary with each string encoded using FSST.
+    struct FSSTEncodedData {
+        std::unique_ptr<ColumnChunkData> stringDataChunk;
+        std::unique_ptr<ColumnChunkData> offsetChunk;
+        std::shared_ptr<const FSSTSymbolTable> symbolTable;
+    };
+    // Encodes the strings with a symbol table trained on a sample of them. Returns nullopt if
+    // compression is disabled or if the encoded string data would not need fewer pages.
+    std::optional<FSSTEncodedData> encodeWithFSST() const;
+    // Replaces FSST encoded string data and offsets scanned from disk with the decoded strings.
+    void decodeFSST(const FSSTSymbolTable& symbolTable);
+    // Marks a flushed string data chunk as holding data encoded with the given symbol table.
+    static void setFSSTMetadata(ColumnChunkData& flushedStringDataChunk,
+        std::shared_ptr<const FSSTSymbolTable> symbolTable);
+
 private:
     bool enableCompression;
     // String data is stored as a UINT8 chunk, using the numValues in the chunk to track the number
@@ -1,9 +1,16 @@
 #pragma once
 
-#include <vector>
+#include <array>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <utility>
+#include <vector>
 
 #include "common/constants.h"
+#include "common/enums/free_chunk_policy.h"
+#include "common/metric.h"
 #include "common/types/types.h"
 #include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
@@ -17,83 +24,134 @@ class Deserializer;
 
 namespace storage {
 
-/* Change this macro if we want to disable FCM feature */
-#define ENABLE_FREE_CHUNK_MAP true
-// #define ENABLE_FREE_CHUNK_MAP false
-
-/*
- * FreeChunkLevel indicates how many pages are free to use in a corresponding FreeChunkEntry
- * Note that: these pages are consecutive in disk space and we are indicating the lower limit
- * Therefore, it is possible to waste some fragmented spaces (in FREE_CHUNK_LEVEL_0)
- */
-enum FreeChunkLevel : int {
-    INVALID_FREE_CHUNK_LEVEL = -1,
-    FREE_CHUNK_LEVEL_0 = 0,
-    FREE_CHUNK_LEVEL_2 = 1,
-    FREE_CHUNK_LEVEL_4 = 2,
-    FREE_CHUNK_LEVEL_8 = 3,
-    FREE_CHUNK_LEVEL_16 = 4,
-    FREE_CHUNK_LEVEL_32 = 5,
-    FREE_CHUNK_LEVEL_64 = 6,
-    FREE_CHUNK_LEVEL_128 = 7,
-    MAX_FREE_CHUNK_LEVEL = 8
-};
-
-/* This const array indicates the upper limit of each level (same as the lower limit of the next level) */
-const common::page_idx_t FreeChunkLevelPageNumLimit[MAX_FREE_CHUNK_LEVEL] = {
-    2, 4, 8, 16, 32, 64, 128, UINT32_MAX
-};
-
 /*
- * FreeChunkEntry is the main structure to maintain free space information of each chunk:
- *   pageIdx indicates the start page of a given data chunk
- *   numPages indicates how many consecutive free pages this data chunk owns
- *   reuseTS is the latest TS when this entry is created. This is to make sure the data of corresponding
- *     data chunk is not recycled until no one keeps TS that is old enough to see it.
- * Note: reuseTS is removed in the 2nd version of implementation since flushing only happens when checkpoint and
+ * FreeChunkEntry describes one free extent in the data file:
+ *   pageIdx indicates the start page of the extent
+ *   numPages indicates how many consecutive free pages this extent owns
+ * Note: we do not keep any version info here since flushing only happens when checkpoint and
  *       checkpoint will wait all other transactions to finish before proceeding and writing data to disk;
  *       with that saying, we are safe to reuse any recycled column chunk here without version control.
  */
 typedef struct FreeChunkEntry {
-    common::page_idx_t pageIdx;
-    common::page_idx_t numPages;
-    std::unique_ptr<FreeChunkEntry> nextEntry = nullptr;
+    common::page_idx_t pageIdx = common::INVALID_PAGE_IDX;
+    common::page_idx_t numPages = 0;
 
     void serialize(common::Serializer& serializer) const;
-    static std::unique_ptr<FreeChunkEntry> deserialize(common::Deserializer &deserializer);
-
+    static FreeChunkEntry deserialize(common::Deserializer& deserializer);
 } FreeChunkEntry;
 
 /*
- * FreeChunkMap is our main data structure here. It maintains a list of linked list of FreeChunkEntry
- * where the index of each L.L. indicates its FreeChunkLevel and offer necessary interface to its user.
+ * Number of buckets of the allocation latency histogram. Bucket i counts the allocations that took
+ * less than 2^i nanoseconds (and at least 2^(i-1) nanoseconds); the last bucket also counts all
+ * slower allocations.
+ */
+static constexpr size_t NUM_ALLOCATION_LATENCY_BUCKETS = 24;
+
+/*
+ * Summary of the free space tracked by FreeChunkMap. fragmentation is defined as
+ * 1 - largestFreeChunk / numFreePages, i.e. 0 when all free pages are in one extent
+ * and close to 1 when free pages are scattered in many small extents.
+ */
+struct FreeChunkMapStats {
+    common::FreeChunkPolicy policy = common::FreeChunkPolicy::BEST_FIT;
+    uint64_t numFreeChunks = 0;
+    uint64_t numFreePages = 0;
+    uint64_t largestFreeChunk = 0;
+    uint64_t numReusedPages = 0;
+    uint64_t numAppendedPages = 0;
+    double fragmentation = 0;
+    std::array<uint64_t, NUM_ALLOCATION_LATENCY_BUCKETS> allocationLatencyHistogram{};
+};
+
+/*
+ * FreeChunkMap is an extent allocator over the pages of the data file. Each free extent is indexed
+ * twice:
+ *   freeChunksByStart orders extents by start page so that neighbouring extents can be coalesced
+ *     in O(log n) when a chunk is recycled
+ *   freeChunksBySize orders extents by (numPages, pageIdx) so that getFreeChunk can pick the
+ *     smallest extent that fits (best-fit) in O(log n)
+ * Both indexes always contain exactly the same set of extents, and no two extents overlap or touch.
+ *
+ * Which extent getFreeChunk picks depends on the FreeChunkPolicy of the database. The policy is
+ * persisted together with the free extents. Freed chunks are tracked under all policies, so that
+ * switching away from APPEND_ONLY can reuse the pages freed so far.
+ *
+ * Recycled chunks are still referenced by the metadata of the last checkpoint until the next checkpoint
+ * is durable. Therefore addFreeChunk only records them as pending, and they become reusable when
+ * releasePendingFreeChunks is called after the checkpoint has been committed. Otherwise a crash in the
+ * middle of a checkpoint could leave the old metadata pointing to overwritten pages.
  */
 class FreeChunkMap {
 public:
-    FreeChunkMap();
+    explicit FreeChunkMap(common::FreeChunkPolicy policy = common::FreeChunkPolicy::BEST_FIT);
     ~FreeChunkMap();
 
-    /* Get a free chunk to write new data */
-    std::unique_ptr<FreeChunkEntry> getFreeChunk(common::page_idx_t numPages);
-    /* Add info of a recycled chunk into FreeChunkMap */
+    common::FreeChunkPolicy getPolicy() const {
+        std::lock_guard lck{mtx};
+        return policy;
+    }
+    void setPolicy(common::FreeChunkPolicy policy_) {
+        std::lock_guard lck{mtx};
+        policy = policy_;
+    }
+
+    /*
+     * Get a free chunk of exactly numPages pages to write new data. The rest of the chosen extent
+     * stays in FreeChunkMap. If maxPageIdx is given, only extents starting before it are considered.
+     * Returns nullptr if no extent is large enough or if the policy is APPEND_ONLY.
+     */
+    std::unique_ptr<FreeChunkEntry> getFreeChunk(common::page_idx_t numPages,
+        common::page_idx_t maxPageIdx = common::INVALID_PAGE_IDX);
+    /* Add info of a recycled chunk into FreeChunkMap. It is reusable after the next checkpoint */
     void addFreeChunk(common::page_idx_t pageIdx, common::page_idx_t numPages);
+    /* Make all pending chunks reusable. Must only be called once a checkpoint is durable */
+    void releasePendingFreeChunks();
+    /* Record pages that had to be appended to the data file because no free chunk was reused */
+    void recordAppendedPages(common::page_idx_t numPages);
+
+    /*
+     * If the last free extent ends at numPagesInFile, remove it and return its start page, which is the
+     * number of pages the file can be truncated to. Otherwise return numPagesInFile.
+     */
+    common::page_idx_t removeTailFreeChunk(common::page_idx_t numPagesInFile);
+    /* Forget all free pages at or after numPagesInFile, e.g. after the file has been truncated */
+    void removeFreeChunksBeyond(common::page_idx_t numPagesInFile);
+
+    FreeChunkMapStats getStats() const;
+    /* All free extents ordered by their start page */
+    std::vector<FreeChunkEntry> getFreeChunks() const;
 
     /* Functions used for persistency of FreeChunkMap data */
     void serialize(common::Serializer& serializer) const;
     void deserialize(common::Deserializer& deserializer);
 
 private:
-    /* Helper functions */
-    FreeChunkLevel getChunkLevel(common::page_idx_t numPages);
-    void updateMaxAvailLevel();
+    /* Helper functions. They expect mtx to be held by the caller */
+    std::vector<FreeChunkEntry> getFreeChunksNoLock() const;
+    std::map<common::page_idx_t, common::page_idx_t>::const_iterator findFirstFit(
+        common::page_idx_t numPages, common::page_idx_t maxPageIdx) const;
+    std::set<std::pair<common::page_idx_t, common::page_idx_t>>::const_iterator findBestFit(
+        common::page_idx_t numPages, common::page_idx_t maxPageIdx) const;
+    void recordAllocationLatency(uint64_t latencyInNs);
+    void insertFreeChunk(common::page_idx_t pageIdx, common::page_idx_t numPages);
+    void insertEntry(common::page_idx_t pageIdx, common::page_idx_t numPages);
+    void removeEntry(common::page_idx_t pageIdx, common::page_idx_t numPages);
 
     /*
-     * No need for locks here since only checkpoint will need free chunks
-     * when all other transactions are blocked
+     * Only checkpoint allocates or recycles chunks, when all other transactions are blocked. However,
+     * node groups are checkpointed in parallel, so all accesses are serialized by mtx.
      */
-    std::vector<std::unique_ptr<FreeChunkEntry>> freeChunkList;
-    std::unordered_set<common::page_idx_t> existingFreeChunks;
-    FreeChunkLevel maxAvailLevel;
+    mutable std::mutex mtx;
+    std::map<common::page_idx_t, common::page_idx_t> freeChunksByStart;
+    std::set<std::pair<common::page_idx_t, common::page_idx_t>> freeChunksBySize;
+    /* Chunks recycled since the last checkpoint */
+    std::vector<FreeChunkEntry> pendingFreeChunks;
+    uint64_t numFreePages;
+    common::FreeChunkPolicy policy;
+    /* Counters since the database was opened. They are not persisted */
+    common::NumericMetric reusedPages;
+    common::NumericMetric appendedPages;
+    std::array<uint64_t, NUM_ALLOCATION_LATENCY_BUCKETS> allocationLatencyHistogram;
 };
 
 } // namespace storage
@@ -88,6 +88,7 @@ public:
     }
 
     std::vector<std::pair<common::page_idx_t, common::page_idx_t>> getAllChunkPhysicInfo() override;
+    void collectOnDiskChunks(std::vector<ColumnChunkData*>& chunks) override;
 
     common::offset_t getListStartOffset(common::offset_t offset) const;
 
@@ -50,6 +50,12 @@ struct NodeGroupCheckpointState {
     std::vector<std::unique_ptr<Column>> columns;
     FileHandle& dataFH;
     MemoryManager* mm;
+    // Persistent node groups whose fraction of deleted rows is at least this threshold are
+    // rewritten densely. A value of 1 or above disables the rewrite.
+    double rewriteThreshold = 1.0;
+    // Index into columnIDs of the primary key column of a node table. Dense rewrites keep the keys
+    // of deleted rows, as the primary key index still refers to them.
+    common::idx_t pkColumnIdx = common::INVALID_IDX;
 
     NodeGroupCheckpointState(std::vector<common::column_id_t> columnIDs,
         std::vector<std::unique_ptr<Column>> columns, FileHandle& dataFH, MemoryManager* mm)
@@ -153,6 +159,9 @@ public:
         getAllChunkPhysicInfoForColumn(common::column_id_t columnID);
     /* This function retrieve the physical info of all column chunk datas of ALL columns */
     std::vector<std::pair<common::page_idx_t, common::page_idx_t>> getAllChunkPhysicInfo();
+    /* This function collects on-disk column chunk datas of the given columns */
+    void collectOnDiskChunks(const std::vector<common::column_id_t>& columnIDs,
+        std::vector<ColumnChunkData*>& chunks);
 
     void flush(transaction::Transaction* transaction, FileHandle& dataFH);
 
@@ -197,6 +206,9 @@ private:
         const common::UniqLock& lock, NodeGroupCheckpointState& state);
     std::unique_ptr<ChunkedNodeGroup> checkpointInMemAndOnDisk(MemoryManager& memoryManager,
         const common::UniqLock& lock, NodeGroupCheckpointState& state);
+    std::unique_ptr<ChunkedNodeGroup> checkpointDenseRewrite(MemoryManager& memoryManager,
+        const common::UniqLock& lock, NodeGroupCheckpointState& state,
+        const VersionInfo& checkpointedVersionInfo);
     std::unique_ptr<VersionInfo> checkpointVersionInfo(const common::UniqLock& lock,
         const transaction::Transaction* transaction);
 
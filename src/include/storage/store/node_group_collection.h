@@ -4,6 +4,9 @@
 #include "storage/store/node_group.h"
 
 namespace kuzu {
+namespace main {
+class ClientContext;
+} // namespace main
 namespace transaction {
 class Transaction;
 }
@@ -59,6 +62,9 @@ public:
         getAllChunkPhysicInfoForColumn(common::column_id_t columnID);
     /* This function retrieve the physical info of all column chunk datas of ALL columns */
     std::vector<std::pair<common::page_idx_t, common::page_idx_t>> getAllChunkPhysicInfo();
+    /* This function collects on-disk column chunk datas of the given columns */
+    void collectOnDiskChunks(const std::vector<common::column_id_t>& columnIDs,
+        std::vector<ColumnChunkData*>& chunks);
 
     common::column_id_t getNumColumns() const { return types.size(); }
 
@@ -67,10 +73,16 @@ public:
     uint64_t getEstimatedMemoryUsage();
 
     void checkpoint(MemoryManager& memoryManager, NodeGroupCheckpointState& state);
+    // Same as checkpoint, but node groups are checkpointed concurrently by the task scheduler. Only
+    // safe if checkpointing one node group does not touch the state of any other node group.
+    void checkpointInParallel(main::ClientContext& context, MemoryManager& memoryManager,
+        NodeGroupCheckpointState& state);
 
     void serialize(common::Serializer& ser);
 
 private:
+    void removeAllDeletedGroups(const common::UniqLock& lock);
+
     bool enableCompression;
     common::row_idx_t numRows;
     std::vector<common::LogicalType> types;
@@ -1,10 +1,12 @@
 #pragma once
 
 #include <cstdint>
+#include <shared_mutex>
 
 #include "common/types/types.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/index/hash_index.h"
+#include "storage/index/secondary_index.h"
 #include "storage/store/node_group_collection.h"
 #include "storage/store/table.h"
 
@@ -14,6 +16,7 @@ class ExpressionEvaluator;
 } // namespace evaluator
 
 namespace catalog {
+class IndexCatalogEntry;
 class NodeTableCatalogEntry;
 class Property;
 } // namespace catalog
@@ -128,8 +131,24 @@ public:
             [&](common::offset_t offset) { return isVisible(transaction, offset); });
     }
 
+    // Builds the index from the committed data. Nodes inserted by the transaction are added when it
+    // commits.
+    void createSecondaryIndex(transaction::Transaction* transaction,
+        const catalog::IndexCatalogEntry& indexEntry, common::column_id_t columnID);
+    // Appends the offsets of the nodes which may have a value between the single selected values of
+    // the bound vectors in the indexed column, see SecondaryIndex::getKeyRange. Equality lookups
+    // pass the key as both bounds. Callers must check the values of the returned nodes.
+    void lookupSecondaryIndex(transaction::Transaction* transaction, common::oid_t indexID,
+        const common::ValueVector* lowerBoundVector, const common::ValueVector* upperBoundVector,
+        std::vector<common::offset_t>& result);
+    // Returns the number of entries the index has in the same range, without reading them. Nodes
+    // inserted by transactions which haven't committed yet aren't counted.
+    uint64_t countSecondaryIndexEntries(common::oid_t indexID,
+        const common::ValueVector* lowerBoundVector, const common::ValueVector* upperBoundVector);
+
     common::column_id_t getPKColumnID() const { return pkColumnID; }
     PrimaryKeyIndex* getPKIndex() const { return pkIndex.get(); }
+    SecondaryIndex* getSecondaryIndex(common::oid_t indexID) const;
     common::column_id_t getNumColumns() const { return columns.size(); }
     Column* getColumnPtr(common::column_id_t columnID) const {
         KU_ASSERT(columnID < columns.size());
@@ -148,7 +167,8 @@ public:
         transaction::Transaction* transaction, ChunkedNodeGroup& chunkedGroup);
 
     void commit(transaction::Transaction* transaction, LocalTable* localTable) override;
-    void checkpoint(common::Serializer& ser, catalog::TableCatalogEntry* tableEntry) override;
+    void checkpoint(main::ClientContext& context, common::Serializer& ser,
+        catalog::TableCatalogEntry* tableEntry) override;
 
     common::node_group_idx_t getNumCommittedNodeGroups() const {
         return nodeGroups->getNumNodeGroups();
@@ -168,6 +188,9 @@ public:
     std::vector<std::pair<common::page_idx_t, common::page_idx_t>> getAllChunkPhysicInfo() {
         return nodeGroups->getAllChunkPhysicInfo();
     }
+    /* Collect on-disk chunks of all columns that are still part of the table */
+    void collectOnDiskChunks(const catalog::TableCatalogEntry& tableEntry,
+        std::vector<ColumnChunkData*>& chunks) const;
 
 private:
     void insertPK(const transaction::Transaction* transaction,
@@ -175,6 +198,15 @@ private:
     void validatePkNotExists(const transaction::Transaction* transaction,
         common::ValueVector* pkVector);
 
+    // Scans a column of the committed or the local node groups, calling func with the node IDs and
+    // values of each batch of visible nodes.
+    void scanColumn(transaction::Transaction* transaction, TableScanSource source,
+        common::column_id_t columnID,
+        const std::function<void(const common::ValueVector&, const common::ValueVector&)>& func);
+    // Drops the indexes dropped from the catalog and merges the new entries of the others. Must be
+    // called before the node groups are checkpointed.
+    void checkpointSecondaryIndexes(main::ClientContext& context);
+
     void serialize(common::Serializer& serializer) const override;
 
 private:
@@ -182,6 +214,9 @@ private:
     std::unique_ptr<NodeGroupCollection> nodeGroups;
     common::column_id_t pkColumnID;
     std::unique_ptr<PrimaryKeyIndex> pkIndex;
+    // Guards the list of secondary indexes, not their contents.
+    mutable std::shared_mutex secondaryIndexesMtx;
+    std::vector<std::unique_ptr<SecondaryIndex>> secondaryIndexes;
 };
 
 } // namespace storage
@@ -62,6 +62,8 @@ public:
 
     void finalize() override;
 
+    // Also computes the zone map of the values
+    ColumnChunkMetadata getMetadataToFlush() const override;
     void flush(FileHandle& dataFH) override;
 
     uint64_t getNumValues() const override { return nullData->getNumValues(); }
@@ -76,6 +78,7 @@ public:
     uint64_t getEstimatedMemoryUsage() const override;
 
     std::vector<std::pair<common::page_idx_t, common::page_idx_t>> getAllChunkPhysicInfo() override;
+    void collectOnDiskChunks(std::vector<ColumnChunkData*>& chunks) override;
 
     void serialize(common::Serializer& serializer) const override;
     static void deserialize(common::Deserializer& deSer, ColumnChunkData& chunkData);
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace storage {
+
+// Statistics of the non-null values of a persistent string chunk, used to skip scanning chunks
+// which can't contain a value satisfying a predicate: a split block Bloom filter of the values, and
+// prefixes of the minimum and maximum values. It is computed when the chunk is flushed and in-place
+// writes add their values to it, so it may rule out values which aren't in the chunk (false
+// positives), but never values which are.
+class StringZoneMap {
+public:
+    // Number of leading bytes of the minimum and maximum values which are kept.
+    static constexpr uint64_t PREFIX_LENGTH = 8;
+    // At 8 bits per distinct value the filter has a false positive rate of about 3%. The metadata
+    // of every chunk is kept in memory, so the filter is limited to 4KB, which covers 4096
+    // distinct values. Chunks with more distinct values only keep the prefixes.
+    static constexpr uint64_t BLOOM_FILTER_BITS_PER_VALUE = 8;
+    static constexpr uint64_t MAX_BLOOM_FILTER_SIZE = 4 * 1024;
+
+    StringZoneMap() = default;
+    // The Bloom filter is sized for the given number of distinct values to be added.
+    explicit StringZoneMap(uint64_t numDistinctValues);
+
+    void add(std::string_view value);
+
+    bool hasValues() const { return numValues > 0; }
+    bool hasBloomFilter() const { return !bloomFilter.empty(); }
+    const std::string& getMinPrefix() const { return minPrefix; }
+    const std::string& getMaxPrefix() const { return maxPrefix; }
+
+    // Each check returns false only if no value in the chunk compares with the given value that
+    // way. The maximum is only known up to its prefix, so there's no separate check for greater
+    // values.
+    bool mayContainEqual(std::string_view value) const;
+    bool mayContainGreaterOrEqual(std::string_view value) const;
+    bool mayContainLess(std::string_view value, bool orEqual) const;
+
+    void serialize(common::Serializer& serializer) const;
+    static StringZoneMap deserialize(common::Deserializer& deserializer);
+
+private:
+    static constexpr uint64_t WORDS_PER_BLOCK = 8;
+
+    bool bloomFilterMayContain(std::string_view value) const;
+
+private:
+    uint64_t numValues = 0;
+    // Only meaningful if there are values
+    std::string minPrefix;
+    std::string maxPrefix;
+    // Blocks of 8 words, each value setting one bit in every word of one block. Empty if there were
+    // too many distinct values to build a useful filter within the maximum size.
+    std::vector<uint32_t> bloomFilter;
+};
+
+} // namespace storage
+} // namespace kuzu
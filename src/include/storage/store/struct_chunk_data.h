@@ -37,6 +37,7 @@ public:
     }
 
     std::vector<std::pair<common::page_idx_t, common::page_idx_t>> getAllChunkPhysicInfo() override;
+    void collectOnDiskChunks(std::vector<ColumnChunkData*>& chunks) override;
 
     void serialize(common::Serializer& serializer) const override;
     static void deserialize(common::Deserializer& deSer, ColumnChunkData& chunkData);
@@ -34,6 +34,10 @@ struct TableScanState {
     NodeGroup* nodeGroup = nullptr;
     std::unique_ptr<NodeGroupScanState> nodeGroupScanState;
 
+    // Set by scans that read node groups sequentially. The pages of persistent column chunks are
+    // then prefetched in batches, and read with the STREAMING hint to not pollute the buffer pool.
+    bool sequentialScan = false;
+
     std::vector<ColumnPredicateSet> columnPredicateSets;
     common::ZoneMapCheckResult zoneMapResult = common::ZoneMapCheckResult::ALWAYS_SCAN;
 
@@ -173,7 +177,8 @@ public:
     }
 
     virtual void commit(transaction::Transaction* transaction, LocalTable* localTable) = 0;
-    virtual void checkpoint(common::Serializer& ser, catalog::TableCatalogEntry* tableEntry) = 0;
+    virtual void checkpoint(main::ClientContext& context, common::Serializer& ser,
+        catalog::TableCatalogEntry* tableEntry) = 0;
 
     virtual common::row_idx_t getNumRows() = 0;
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <mutex>
+
 #include "function/hash/hash_functions.h"
 #include "storage/db_file_id.h"
 #include "storage/file_handle.h"
@@ -20,15 +22,16 @@ struct ShadowFileHeader {
     common::page_idx_t numShadowPages = 0;
 };
 
-// NOTE: This class is NOT thread-safe for now, as we are not checkpointing in parallel yet.
+// Node groups are checkpointed in parallel, so accesses to the shadow page map are serialized by a
+// mutex. Replaying, flushing and clearing are still done by a single thread.
 class ShadowFile {
 public:
     ShadowFile(const std::string& directory, bool readOnly, BufferManager& bufferManager,
         common::VirtualFileSystem* vfs, main::ClientContext* context);
 
     bool hasShadowPage(common::file_idx_t originalFile, common::page_idx_t originalPage) const {
-        return shadowPagesMap.contains(originalFile) &&
-               shadowPagesMap.at(originalFile).contains(originalPage);
+        std::lock_guard lck{mtx};
+        return hasShadowPageNoLock(originalFile, originalPage);
     }
     void clearShadowPage(common::file_idx_t originalFile, common::page_idx_t originalPage);
     common::page_idx_t getShadowPage(common::file_idx_t originalFile,
@@ -49,7 +52,14 @@ private:
 
     void deserializeShadowPageRecords();
 
+    bool hasShadowPageNoLock(common::file_idx_t originalFile,
+        common::page_idx_t originalPage) const {
+        return shadowPagesMap.contains(originalFile) &&
+               shadowPagesMap.at(originalFile).contains(originalPage);
+    }
+
 private:
+    mutable std::mutex mtx;
     FileHandle* shadowingFH;
     // The map caches shadow page idxes for pages in original files.
     std::unordered_map<common::file_idx_t,
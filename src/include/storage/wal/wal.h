@@ -1,6 +1,9 @@
 #pragma once
 
+#include <array>
+#include <condition_variable>
 #include <cstdint>
+#include <mutex>
 #include <unordered_set>
 
 #include "common/enums/rel_direction.h"
@@ -25,6 +28,19 @@ struct SequenceRollbackData;
 
 namespace storage {
 class WALReplayer;
+
+// Number of buckets of the sync latency histogram. Bucket i counts the syncs that took less than 2^i
+// microseconds; the last bucket also counts all slower syncs.
+static constexpr size_t NUM_WAL_SYNC_LATENCY_BUCKETS = 24;
+
+// Counters of group commit since the database was opened.
+struct WALGroupCommitStats {
+    uint64_t numSyncedCommits = 0;
+    uint64_t numSyncs = 0;
+    uint64_t maxBatchSize = 0;
+    std::array<uint64_t, NUM_WAL_SYNC_LATENCY_BUCKETS> syncLatencyHistogram{};
+};
+
 class WAL {
     friend class WALReplayer;
 
@@ -59,7 +75,13 @@ public:
     void logCopyTableRecord(common::table_id_t tableID);
 
     void logBeginTransaction();
-    void logAndFlushCommit();
+    // Appends a commit record without syncing the WAL, and returns the sequence number of the
+    // commit. The commit is durable once syncCommit returns for this sequence number.
+    uint64_t logCommit();
+    // Group commit. Waits until all commits up to commitSeq are synced to disk. If no other thread is
+    // syncing, the caller becomes the leader of the next batch: it waits up to maxDelayInMicros for
+    // more commits to join, then flushes and syncs the WAL once for all of them.
+    void syncCommit(uint64_t commitSeq, uint64_t maxDelayInMicros);
     void logRollback();
     void logAndFlushCheckpoint();
 
@@ -73,10 +95,26 @@ public:
     }
     std::unordered_set<common::table_id_t>& getUpdatedTables() { return updatedTables; }
 
-    uint64_t getFileSize() const { return bufferedWriter->getFileSize(); }
+    uint64_t getFileSize() const {
+        std::unique_lock<std::mutex> lck{mtx};
+        return bufferedWriter->getFileSize();
+    }
+
+    uint64_t getLastCommitSeq() const {
+        std::unique_lock<std::mutex> lck{mtx};
+        return lastCommitSeq;
+    }
+
+    WALGroupCommitStats getGroupCommitStats() const {
+        std::unique_lock<std::mutex> lck{groupCommitMtx};
+        return groupCommitStats;
+    }
 
 private:
     void addNewWALRecordNoLock(const WALRecord& walRecord);
+    void flushAllPagesNoLock();
+    // Marks all commits up to commitSeq as synced and wakes up the threads waiting for them.
+    void markCommitsSynced(uint64_t commitSeq);
 
 private:
     // Keep track of tables that has updates since last checkpoint. Ideally this is used to
@@ -86,8 +124,17 @@ private:
     std::unique_ptr<common::FileInfo> fileInfo;
     std::shared_ptr<common::BufferedFileWriter> bufferedWriter;
     std::string directory;
-    std::mutex mtx;
+    // Protects bufferedWriter and lastCommitSeq.
+    mutable std::mutex mtx;
     common::VirtualFileSystem* vfs;
+    uint64_t lastCommitSeq;
+
+    // Protects the group commit state below. Never acquire mtx while holding it.
+    mutable std::mutex groupCommitMtx;
+    std::condition_variable groupCommitCV;
+    uint64_t syncedCommitSeq;
+    bool hasSyncLeader;
+    WALGroupCommitStats groupCommitStats;
 };
 
 } // namespace storage
@@ -37,10 +37,18 @@ private:
     bool canAutoCheckpoint(const main::ClientContext& clientContext) const;
     bool canCheckpointNoLock() const;
     void checkpointNoLock(main::ClientContext& clientContext);
+    // Checkpoints only if no other transaction is active or starting, without waiting for them.
+    // Returns false if the checkpoint is skipped.
+    bool tryCheckpointNoLock(main::ClientContext& clientContext);
+    // Performs the checkpoint. New transactions must have been stopped by the caller.
+    void checkpointWithoutActiveTransactionsNoLock(main::ClientContext& clientContext);
     // This functions locks the mutex to start new transactions. This lock needs to be manually
     // unlocked later by calling allowReceivingNewTransactions() by the thread that called
     // stopNewTransactionsAndWaitUntilAllTransactionsLeave().
     void stopNewTransactionsAndWaitUntilAllTransactionsLeave();
+    // Same as above, but gives up immediately instead of waiting. If it returns true, the lock is
+    // held and has to be unlocked by calling allowReceivingNewTransactions().
+    bool tryStopNewTransactionsWithoutActiveTransactions();
     void allowReceivingNewTransactions();
 
     bool hasActiveWriteTransactionNoLock() const { return !activeWriteTransactions.empty(); }
@@ -62,6 +70,11 @@ private:
     std::mutex mtxForSerializingPublicFunctionCalls;
     std::mutex mtxForStartingNewTransactions;
     uint64_t checkpointWaitTimeoutInMicros = common::DEFAULT_CHECKPOINT_WAIT_TIMEOUT_IN_MICROS;
+    // Number of non-blocking auto checkpoints skipped since the last checkpoint because other
+    // transactions were active. Once it reaches MAX_NUM_SKIPPED_AUTO_CHECKPOINTS, the next auto
+    // checkpoint waits for active transactions to leave like a blocking one.
+    static constexpr uint64_t MAX_NUM_SKIPPED_AUTO_CHECKPOINTS = 16;
+    uint64_t numSkippedAutoCheckpoints = 0;
 };
 } // namespace transaction
 } // namespace kuzu
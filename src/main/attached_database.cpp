@@ -59,7 +59,8 @@ AttachedKuzuDatabase::AttachedKuzuDatabase(std::string dbPath, std::string dbNam
     validateEmptyWAL(path, clientContext);
     storageManager = std::make_unique<storage::StorageManager>(path, true /* isReadOnly */,
         *catalog, *clientContext->getMemoryManager(),
-        clientContext->getDBConfig()->enableCompression, vfs, clientContext);
+        clientContext->getDBConfig()->enableCompression, std::nullopt /* freeChunkPolicy */, vfs,
+        clientContext);
     transactionManager =
         std::make_unique<transaction::TransactionManager>(storageManager->getWAL());
 }
@@ -28,9 +28,11 @@ namespace kuzu {
 namespace main {
 
 SystemConfig::SystemConfig(uint64_t bufferPoolSize_, uint64_t maxNumThreads, bool enableCompression,
-    bool readOnly, uint64_t maxDBSize, bool autoCheckpoint, uint64_t checkpointThreshold)
+    bool readOnly, uint64_t maxDBSize, bool autoCheckpoint, uint64_t checkpointThreshold,
+    std::optional<FreeChunkPolicy> freeChunkPolicy, bool useHugePages, NumaPolicy numaPolicy)
     : maxNumThreads{maxNumThreads}, enableCompression{enableCompression}, readOnly{readOnly},
-      autoCheckpoint{autoCheckpoint}, checkpointThreshold{checkpointThreshold} {
+      autoCheckpoint{autoCheckpoint}, checkpointThreshold{checkpointThreshold},
+      freeChunkPolicy{freeChunkPolicy}, useHugePages{useHugePages}, numaPolicy{numaPolicy} {
     if (bufferPoolSize_ == -1u || bufferPoolSize_ == 0) {
 #if defined(_WIN32)
         MEMORYSTATUSEX status;
@@ -80,12 +82,16 @@ Database::Database(std::string_view databasePath, SystemConfig systemConfig)
     initAndLockDBDir();
     bufferManager = std::make_unique<BufferManager>(this->databasePath,
         this->dbConfig.spillToDiskTmpFile.value_or(vfs->joinPath(this->databasePath, "copy.tmp")),
-        this->dbConfig.bufferPoolSize, this->dbConfig.maxDBSize, vfs.get(), dbConfig.readOnly);
+        this->dbConfig.bufferPoolSize, this->dbConfig.maxDBSize, vfs.get(), dbConfig.readOnly,
+        dbConfig.useHugePages, dbConfig.numaPolicy);
     memoryManager = std::make_unique<MemoryManager>(bufferManager.get(), vfs.get());
     queryProcessor = std::make_unique<processor::QueryProcessor>(dbConfig.maxNumThreads);
     catalog = std::make_unique<Catalog>(this->databasePath, vfs.get());
     storageManager = std::make_unique<StorageManager>(dbPathStr, dbConfig.readOnly, *catalog,
-        *memoryManager, dbConfig.enableCompression, vfs.get(), &clientContext);
+        *memoryManager, dbConfig.enableCompression, systemConfig.freeChunkPolicy, vfs.get(),
+        &clientContext);
+    // The persisted policy, unless one was configured explicitly.
+    dbConfig.freeChunkPolicy = storageManager->getDataFH()->getFreeChunkMap().getPolicy();
     transactionManager = std::make_unique<TransactionManager>(storageManager->getWAL());
     StorageManager::recover(clientContext);
     extensionOptions = std::make_unique<extension::ExtensionOptions>();
@@ -21,14 +21,23 @@ static ConfigurationOption options[] = { // NOLINT(cert-err58-cpp):
     GET_CONFIGURATION(ProgressBarTimerSetting), GET_CONFIGURATION(RecursivePatternSemanticSetting),
     GET_CONFIGURATION(RecursivePatternFactorSetting), GET_CONFIGURATION(EnableMVCCSetting),
     GET_CONFIGURATION(CheckpointThresholdSetting), GET_CONFIGURATION(AutoCheckpointSetting),
-    GET_CONFIGURATION(ForceCheckpointClosingDBSetting), GET_CONFIGURATION(SpillToDiskFileSetting)};
+    GET_CONFIGURATION(ForceCheckpointClosingDBSetting), GET_CONFIGURATION(SpillToDiskFileSetting),
+    GET_CONFIGURATION(CheckpointCompactionSetting),
+    GET_CONFIGURATION(NodeGroupRewriteThresholdSetting),
+    GET_CONFIGURATION(FreeChunkPolicySetting), GET_CONFIGURATION(NonBlockingAutoCheckpointSetting),
+    GET_CONFIGURATION(GroupCommitMaxDelaySetting)};
 
 DBConfig::DBConfig(const SystemConfig& systemConfig)
     : bufferPoolSize{systemConfig.bufferPoolSize}, maxNumThreads{systemConfig.maxNumThreads},
       enableCompression{systemConfig.enableCompression}, readOnly{systemConfig.readOnly},
       maxDBSize{systemConfig.maxDBSize}, enableMultiWrites{false},
       autoCheckpoint{systemConfig.autoCheckpoint},
-      checkpointThreshold{systemConfig.checkpointThreshold}, forceCheckpointOnClose{true} {}
+      checkpointThreshold{systemConfig.checkpointThreshold}, forceCheckpointOnClose{true},
+      checkpointCompaction{false}, nodeGroupRewriteThreshold{1.0},
+      freeChunkPolicy{systemConfig.freeChunkPolicy.value_or(FreeChunkPolicy::BEST_FIT)},
+      nonBlockingAutoCheckpoint{false},
+      groupCommitMaxDelayInMicros{0}, useHugePages{systemConfig.useHugePages},
+      numaPolicy{systemConfig.numaPolicy} {}
 
 ConfigurationOption* DBConfig::getOptionByName(const std::string& optionName) {
     auto lOptionName = optionName;
@@ -0,0 +1,27 @@
+#include "main/settings.h"
+
+#include "storage/file_handle.h"
+#include "storage/storage_manager.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace main {
+
+void FreeChunkPolicySetting::setContext(ClientContext* context, const Value& parameter) {
+    parameter.validateType(inputType);
+    const auto policy = FreeChunkPolicyUtils::fromString(parameter.getValue<std::string>());
+    context->getDBConfigUnsafe()->freeChunkPolicy = policy;
+    // The policy is persisted together with the free chunk map at the next checkpoint.
+    if (const auto dataFH = context->getStorageManager()->getDataFH()) {
+        dataFH->getFreeChunkMap().setPolicy(policy);
+    }
+}
+
+Value FreeChunkPolicySetting::getSetting(const ClientContext* context) {
+    return Value::createValue(
+        FreeChunkPolicyUtils::toString(context->getDBConfig()->freeChunkPolicy));
+}
+
+} // namespace main
+} // namespace kuzu
@@ -3,7 +3,11 @@
 #include "binder/expression/literal_expression.h"
 #include "binder/expression/property_expression.h"
 #include "binder/expression/scalar_function_expression.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/index_catalog_entry.h"
 #include "main/client_context.h"
+#include "planner/join_order/cardinality_estimator.h"
+#include "planner/join_order/cost_model.h"
 #include "planner/operator/extend/logical_extend.h"
 #include "planner/operator/logical_empty_result.h"
 #include "planner/operator/logical_filter.h"
@@ -173,15 +177,117 @@ static bool isConstantExpression(const std::shared_ptr<Expression> expression) {
     }
 }
 
+static bool isNodeProperty(const Expression& expression, const Expression& nodeID) {
+    return expression.expressionType == ExpressionType::PROPERTY &&
+           expression.constCast<PropertyExpression>().getVariableName() ==
+               nodeID.constCast<PropertyExpression>().getVariableName();
+}
+
+// If the predicate compares the property to a constant of the same type, returns the constant and
+// sets comparisonType to the comparison of the property with it. Returns nullptr otherwise.
+static std::shared_ptr<Expression> getComparedConstant(const Expression& predicate,
+    const Expression& nodeID, const std::string& propertyName, ExpressionType& comparisonType) {
+    switch (predicate.expressionType) {
+    case ExpressionType::EQUALS:
+    case ExpressionType::GREATER_THAN:
+    case ExpressionType::GREATER_THAN_EQUALS:
+    case ExpressionType::LESS_THAN:
+    case ExpressionType::LESS_THAN_EQUALS:
+        break;
+    default:
+        return nullptr;
+    }
+    for (auto isReversed : {false, true}) {
+        auto property = predicate.getChild(isReversed ? 1 : 0);
+        auto constant = predicate.getChild(isReversed ? 0 : 1);
+        if (isNodeProperty(*property, nodeID) && isConstantExpression(constant) &&
+            property->dataType == constant->dataType &&
+            property->constCast<PropertyExpression>().getPropertyName() == propertyName) {
+            comparisonType = predicate.expressionType;
+            if (isReversed) {
+                comparisonType = ExpressionTypeUtil::reverseComparisonDirection(comparisonType);
+            }
+            return constant;
+        }
+    }
+    return nullptr;
+}
+
+// Returns a scan of the index for the comparisons between the indexed property and constants, or
+// nullptr if there are none. Any index can be used for an equality comparison, while ranges can
+// only be scanned in ORDERED indexes.
+static std::unique_ptr<SecondaryIndexScanInfo> getSecondaryIndexScanInfo(
+    const catalog::IndexCatalogEntry& indexEntry, const Expression& nodeID,
+    const expression_vector& predicates) {
+    std::shared_ptr<Expression> lowerBound;
+    std::shared_ptr<Expression> upperBound;
+    for (auto& predicate : predicates) {
+        auto comparisonType = ExpressionType::EQUALS;
+        auto constant =
+            getComparedConstant(*predicate, nodeID, indexEntry.getPropertyName(), comparisonType);
+        if (constant == nullptr) {
+            continue;
+        }
+        switch (comparisonType) {
+        case ExpressionType::EQUALS:
+            return std::make_unique<SecondaryIndexScanInfo>(indexEntry.getOID(),
+                indexEntry.getName(), constant, constant);
+        case ExpressionType::GREATER_THAN:
+        case ExpressionType::GREATER_THAN_EQUALS: {
+            if (lowerBound == nullptr) {
+                lowerBound = constant;
+            }
+        } break;
+        default: {
+            if (upperBound == nullptr) {
+                upperBound = constant;
+            }
+        }
+        }
+    }
+    if (indexEntry.getIndexType() != SecondaryIndexType::ORDERED ||
+        (lowerBound == nullptr && upperBound == nullptr)) {
+        return nullptr;
+    }
+    return std::make_unique<SecondaryIndexScanInfo>(indexEntry.getOID(), indexEntry.getName(),
+        std::move(lowerBound), std::move(upperBound));
+}
+
+// Returns the index scan with the lowest estimated cost, or nullptr if none is expected to be
+// cheaper than scanning the whole table.
+static std::unique_ptr<SecondaryIndexScanInfo> tryGetSecondaryIndexScanInfo(
+    main::ClientContext* context, const Expression& nodeID, table_id_t tableID,
+    const expression_vector& predicates) {
+    const auto indexEntries = context->getCatalog()->getIndexEntries(context->getTx(), tableID);
+    if (indexEntries.empty()) {
+        return nullptr;
+    }
+    auto cardinalityEstimator = CardinalityEstimator(context);
+    std::unique_ptr<SecondaryIndexScanInfo> result;
+    auto minCost = CostModel::computeScanNodeTableCost(cardinalityEstimator.getNumNodes({tableID}));
+    for (auto& indexEntry : indexEntries) {
+        auto info = getSecondaryIndexScanInfo(*indexEntry, nodeID, predicates);
+        if (info == nullptr) {
+            continue;
+        }
+        const auto cost = CostModel::computeSecondaryIndexScanCost(
+            cardinalityEstimator.estimateSecondaryIndexScan(tableID, *info));
+        if (cost < minCost) {
+            minCost = cost;
+            result = std::move(info);
+        }
+    }
+    return result;
+}
+
 std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitScanNodeTableReplace(
     const std::shared_ptr<LogicalOperator>& op) {
     auto& scan = op->cast<LogicalScanNodeTable>();
     auto nodeID = scan.getNodeID();
-    // Apply column predicates.
-    if (context->getClientConfig()->enableZoneMap) {
-        scan.setPropertyPredicates(
-            getColumnPredicateSets(scan.getProperties(), predicateSet.getAllPredicates()));
-    }
+    // Apply column predicates. The scan evaluates them on compressed data to skip rows early, but
+    // they are still kept in the predicate set, to be applied by the filter above the scan.
+    scan.setPropertyPredicates(
+        getColumnPredicateSets(scan.getProperties(), predicateSet.getAllPredicates()));
     // Apply index scan
     auto tableIDs = scan.getTableIDs();
     std::shared_ptr<Expression> primaryKeyEqualityComparison = nullptr;
@@ -200,6 +306,16 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitScanNodeTableRepl
             predicateSet.addPredicate(primaryKeyEqualityComparison);
         }
     }
+    if (tableIDs.size() == 1 && scan.getScanType() == LogicalScanNodeTableType::SCAN) {
+        // Try rewrite secondary index scan. The predicate is kept.
+        auto extraInfo = tryGetSecondaryIndexScanInfo(context, *nodeID, tableIDs[0],
+            predicateSet.getAllPredicates());
+        if (extraInfo != nullptr) {
+            scan.setScanType(LogicalScanNodeTableType::SECONDARY_INDEX_SCAN);
+            scan.setExtraInfo(std::move(extraInfo));
+            scan.computeFlatSchema();
+        }
+    }
     return finishPushDown(op);
 }
 
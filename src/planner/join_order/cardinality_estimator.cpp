@@ -1,11 +1,13 @@
 #include "planner/join_order/cardinality_estimator.h"
 
 #include "binder/expression/property_expression.h"
+#include "binder/expression/scalar_function_expression.h"
+#include "expression_evaluator/expression_evaluator_utils.h"
 #include "main/client_context.h"
 #include "planner/join_order/join_order_util.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
 #include "storage/storage_manager.h"
-#include "storage/store/table.h"
+#include "storage/store/node_table.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::common;
@@ -106,6 +108,58 @@ uint64_t CardinalityEstimator::estimateFilter(const LogicalPlan& childPlan,
     }
 }
 
+// Parameters may change between executions of a prepared statement, so only literals are evaluated
+// while planning.
+static bool isLiteral(const Expression& expression) {
+    switch (expression.expressionType) {
+    case ExpressionType::LITERAL:
+        return true;
+    case ExpressionType::FUNCTION:
+        return expression.constCast<ScalarFunctionExpression>().getFunction().name == "CAST" &&
+               isLiteral(*expression.getChild(0));
+    default:
+        return false;
+    }
+}
+
+uint64_t CardinalityEstimator::estimateSecondaryIndexScan(table_id_t tableID,
+    const SecondaryIndexScanInfo& info) {
+    auto& table = context->getStorageManager()->getTable(tableID)->cast<storage::NodeTable>();
+    const auto bounds = {info.lowerBound, info.upperBound};
+    if (std::all_of(bounds.begin(), bounds.end(),
+            [](const auto& bound) { return bound == nullptr || isLiteral(*bound); })) {
+        std::vector<std::unique_ptr<ValueVector>> boundVectors;
+        for (auto& bound : bounds) {
+            if (bound == nullptr) {
+                boundVectors.push_back(nullptr);
+                continue;
+            }
+            const auto value =
+                evaluator::ExpressionEvaluatorUtils::evaluateConstantExpression(bound, context);
+            if (value.isNull()) {
+                return 0;
+            }
+            auto vector =
+                std::make_unique<ValueVector>(bound->dataType.copy(), context->getMemoryManager());
+            vector->setState(DataChunkState::getSingleValueDataChunkState());
+            vector->copyFromValue(0, value);
+            boundVectors.push_back(std::move(vector));
+        }
+        return table.countSecondaryIndexEntries(info.indexID, boundVectors[0].get(),
+            boundVectors[1].get());
+    }
+    if (info.isEquality()) {
+        return atLeastOne(table.getNumRows() * PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY);
+    }
+    double selectivity = 1;
+    for (auto& bound : bounds) {
+        if (bound != nullptr) {
+            selectivity *= PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY;
+        }
+    }
+    return atLeastOne(table.getNumRows() * selectivity);
+}
+
 uint64_t CardinalityEstimator::getNumNodes(const std::vector<table_id_t>& tableIDs) {
     auto numNodes = 1u;
     for (auto& tableID : tableIDs) {
@@ -47,5 +47,13 @@ uint64_t CostModel::computeIntersectCost(const kuzu::planner::LogicalPlan& probe
     return cost;
 }
 
+uint64_t CostModel::computeSecondaryIndexScanCost(uint64_t numCandidates) {
+    return PlannerKnobs::SECONDARY_INDEX_LOOKUP_PENALTY * numCandidates;
+}
+
+uint64_t CostModel::computeScanNodeTableCost(uint64_t numNodes) {
+    return numNodes;
+}
+
 } // namespace planner
 } // namespace kuzu
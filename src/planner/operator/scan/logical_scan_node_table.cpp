@@ -3,6 +3,14 @@
 namespace kuzu {
 namespace planner {
 
+std::string SecondaryIndexScanInfo::keyToString() const {
+    if (isEquality()) {
+        return lowerBound->toString();
+    }
+    return "[" + (lowerBound ? lowerBound->toString() : "-inf") + ", " +
+           (upperBound ? upperBound->toString() : "inf") + "]";
+}
+
 LogicalScanNodeTable::LogicalScanNodeTable(const LogicalScanNodeTable& other)
     : LogicalOperator{type_}, scanType{other.scanType}, nodeID{other.nodeID},
       nodeTableIDs{other.nodeTableIDs}, properties{other.properties},
@@ -80,6 +80,13 @@ std::unique_ptr<LogicalPlan> Planner::planCopyNodeFrom(const BoundCopyFromInfo*
     default:
         KU_UNREACHABLE;
     }
+    if (info->extraInfo != nullptr) {
+        // Writing rows in cluster key order keeps each node group's key range narrow, so zone
+        // maps on the key can skip most node groups.
+        auto& extraInfo = info->extraInfo->constCast<ExtraBoundCopyNodeInfo>();
+        appendOrderBy(expression_vector{extraInfo.clusterKey}, std::vector<bool>{true},
+            *plan);
+    }
     appendCopyFrom(*info, results, *plan);
     return plan;
 }
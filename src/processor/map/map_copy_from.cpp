@@ -4,6 +4,7 @@
 #include "planner/operator/persistent/logical_copy_from.h"
 #include "processor/operator/aggregate/hash_aggregate_scan.h"
 #include "processor/operator/index_lookup.h"
+#include "processor/operator/order_by/order_by_scan.h"
 #include "processor/operator/partitioner.h"
 #include "processor/operator/persistent/copy_rdf.h"
 #include "processor/operator/persistent/node_batch_insert.h"
@@ -78,6 +79,9 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapCopyNodeFrom(LogicalOperator* l
     if (prevOperator->getOperatorType() == PhysicalOperatorType::TABLE_FUNCTION_CALL) {
         const auto call = prevOperator->ptrCast<TableFunctionCall>();
         sharedState->readerSharedState = call->getSharedState();
+    } else if (prevOperator->getOperatorType() == PhysicalOperatorType::ORDER_BY_SCAN) {
+        const auto orderByScan = prevOperator->ptrCast<OrderByScan>();
+        sharedState->sortSharedState = orderByScan->getSharedState();
     } else {
         KU_ASSERT(prevOperator->getOperatorType() == PhysicalOperatorType::AGGREGATE_SCAN);
         const auto hashScan = prevOperator->ptrCast<HashAggregateScan>();
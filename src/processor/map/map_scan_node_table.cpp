@@ -3,6 +3,7 @@
 #include "processor/operator/scan/offset_scan_node_table.h"
 #include "processor/operator/scan/primary_key_scan_node_table.h"
 #include "processor/operator/scan/scan_node_table.h"
+#include "processor/operator/scan/secondary_index_scan_node_table.h"
 #include "processor/plan_mapper.h"
 #include "storage/storage_manager.h"
 
@@ -77,6 +78,26 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeTable(LogicalOperator*
         return std::make_unique<PrimaryKeyScanNodeTable>(std::move(scanInfo), std::move(tableInfos),
             std::move(evaluator), std::move(sharedState), getOperatorID(), std::move(printInfo));
     }
+    case LogicalScanNodeTableType::SECONDARY_INDEX_SCAN: {
+        KU_ASSERT(tableInfos.size() == 1);
+        auto& secondaryIndexScanInfo = scan.getExtraInfo()->constCast<SecondaryIndexScanInfo>();
+        auto exprMapper = ExpressionMapper(outSchema);
+        std::unique_ptr<evaluator::ExpressionEvaluator> lowerBoundEvaluator;
+        std::unique_ptr<evaluator::ExpressionEvaluator> upperBoundEvaluator;
+        if (secondaryIndexScanInfo.lowerBound) {
+            lowerBoundEvaluator = exprMapper.getEvaluator(secondaryIndexScanInfo.lowerBound);
+        }
+        if (secondaryIndexScanInfo.upperBound) {
+            upperBoundEvaluator = exprMapper.getEvaluator(secondaryIndexScanInfo.upperBound);
+        }
+        auto sharedState = std::make_shared<SecondaryIndexScanSharedState>();
+        auto printInfo = std::make_unique<SecondaryIndexScanPrintInfo>(scan.getProperties(),
+            secondaryIndexScanInfo.indexName, secondaryIndexScanInfo.keyToString());
+        return std::make_unique<SecondaryIndexScanNodeTable>(std::move(scanInfo),
+            std::move(tableInfos[0]), secondaryIndexScanInfo.indexID,
+            std::move(lowerBoundEvaluator), std::move(upperBoundEvaluator), std::move(sharedState),
+            getOperatorID(), std::move(printInfo));
+    }
     default:
         KU_UNREACHABLE;
     }
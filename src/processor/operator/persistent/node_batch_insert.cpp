@@ -5,6 +5,7 @@
 #include "common/string_format.h"
 #include "function/table/scan_functions.h"
 #include "processor/execution_context.h"
+#include "processor/operator/order_by/sort_state.h"
 #include "processor/operator/persistent/index_builder.h"
 #include "processor/result/factorized_table.h"
 #include "processor/result/factorized_table_util.h"
@@ -27,10 +28,14 @@ std::string NodeBatchInsertPrintInfo::toString() const {
 void NodeBatchInsertSharedState::initPKIndex(const ExecutionContext* context) {
     uint64_t numRows = 0;
     if (readerSharedState != nullptr) {
-        KU_ASSERT(distinctSharedState == nullptr);
+        KU_ASSERT(distinctSharedState == nullptr && sortSharedState == nullptr);
         const auto scanSharedState =
             readerSharedState->funcState->ptrCast<function::BaseScanSharedState>();
         numRows = scanSharedState->getNumRows();
+    } else if (sortSharedState != nullptr) {
+        KU_ASSERT(distinctSharedState == nullptr);
+        const auto mergedKeyBlocks = sortSharedState->getMergedKeyBlock();
+        numRows = mergedKeyBlocks == nullptr ? 0 : mergedKeyBlocks->getNumTuples();
     } else {
         KU_ASSERT(distinctSharedState);
         numRows = distinctSharedState->getFactorizedTable()->getNumTuples();
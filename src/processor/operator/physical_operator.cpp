@@ -94,6 +94,8 @@ std::string PhysicalOperatorUtils::operatorTypeToString(PhysicalOperatorType ope
         return "SCAN_NODE_TABLE";
     case PhysicalOperatorType::SCAN_REL_TABLE:
         return "SCAN_REL_TABLE";
+    case PhysicalOperatorType::SECONDARY_INDEX_SCAN_NODE_TABLE:
+        return "SECONDARY_INDEX_SCAN_NODE_TABLE";
     case PhysicalOperatorType::SEMI_MASKER:
         return "SEMI_MASKER";
     case PhysicalOperatorType::SET_PROPERTY:
@@ -86,6 +86,8 @@ void ScanNodeTable::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
     for (auto i = 0u; i < nodeInfos.size(); ++i) {
         auto& nodeInfo = nodeInfos[i];
         nodeInfo.initScanState(sharedStates[i]->getSemiMask());
+        // Node groups are scanned sequentially, unlike in offset and primary key scans.
+        nodeInfo.localScanState->sequentialScan = true;
         initVectors(*nodeInfo.localScanState, *resultSet);
     }
 }
@@ -0,0 +1,137 @@
+#include "processor/operator/scan/secondary_index_scan_node_table.h"
+
+#include "binder/expression/expression_util.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace processor {
+
+std::string SecondaryIndexScanPrintInfo::toString() const {
+    std::string result = "Index: ";
+    result += indexName;
+    result += ", Key: ";
+    result += key;
+    result += ", Expressions: ";
+    result += binder::ExpressionUtil::toString(expressions);
+    return result;
+}
+
+std::span<const offset_t> SecondaryIndexScanSharedState::getNextBatch(
+    const std::function<void(std::vector<offset_t>&)>& lookupFunc) {
+    std::unique_lock lck{mtx};
+    if (!initialized) {
+        lookupFunc(offsets);
+        // A node is indexed once for every value it had, which may share a key.
+        std::sort(offsets.begin(), offsets.end());
+        offsets.erase(std::unique(offsets.begin(), offsets.end()), offsets.end());
+        initialized = true;
+    }
+    // Offsets of nodes inserted by the transaction are larger than all committed ones, so they
+    // are never in the same node group as those.
+    const auto startIdx = cursor;
+    const auto nodeGroupIdx =
+        cursor < offsets.size() ? StorageUtils::getNodeGroupIdx(offsets[cursor]) : 0;
+    while (cursor < offsets.size() && cursor - startIdx < DEFAULT_VECTOR_CAPACITY &&
+           StorageUtils::getNodeGroupIdx(offsets[cursor]) == nodeGroupIdx) {
+        cursor++;
+    }
+    return std::span(offsets).subspan(startIdx, cursor - startIdx);
+}
+
+void SecondaryIndexScanNodeTable::initLocalStateInternal(ResultSet* resultSet,
+    ExecutionContext* context) {
+    std::vector<Column*> columns;
+    columns.reserve(nodeInfo.columnIDs.size());
+    for (const auto columnID : nodeInfo.columnIDs) {
+        if (columnID == INVALID_COLUMN_ID) {
+            columns.push_back(nullptr);
+        } else {
+            columns.push_back(&nodeInfo.table->getColumn(columnID));
+        }
+    }
+    nodeInfo.localScanState = std::make_unique<NodeTableScanState>(nodeInfo.table->getTableID(),
+        nodeInfo.columnIDs, columns);
+    initVectors(*nodeInfo.localScanState, *resultSet);
+    for (auto* evaluator : {lowerBoundEvaluator.get(), upperBoundEvaluator.get()}) {
+        if (evaluator) {
+            evaluator->init(*resultSet, context->clientContext);
+        }
+    }
+}
+
+void SecondaryIndexScanNodeTable::initVectors(TableScanState& state,
+    const ResultSet& resultSet) const {
+    ScanTable::initVectors(state, resultSet);
+    state.rowIdxVector->state = state.nodeIDVector->state;
+    state.outState = state.rowIdxVector->state.get();
+}
+
+ValueVector* SecondaryIndexScanNodeTable::evaluateBound(evaluator::ExpressionEvaluator* evaluator,
+    bool& isNull) {
+    if (!evaluator) {
+        return nullptr;
+    }
+    evaluator->evaluate();
+    auto vector = evaluator->resultVector.get();
+    KU_ASSERT(vector->state->getSelVector().getSelSize() == 1);
+    if (vector->isNull(vector->state->getSelVector()[0])) {
+        isNull = true;
+    }
+    return vector;
+}
+
+bool SecondaryIndexScanNodeTable::getNextTuplesInternal(ExecutionContext* context) {
+    auto transaction = context->clientContext->getTx();
+    auto& scanState = *nodeInfo.localScanState;
+    const auto lookupFunc = [&](std::vector<offset_t>& offsets) {
+        // Comparisons with null are never true.
+        bool isNull = false;
+        auto lowerBoundVector = evaluateBound(lowerBoundEvaluator.get(), isNull);
+        auto upperBoundVector = evaluateBound(upperBoundEvaluator.get(), isNull);
+        if (isNull) {
+            return;
+        }
+        nodeInfo.table->lookupSecondaryIndex(transaction, indexID, lowerBoundVector,
+            upperBoundVector, offsets);
+    };
+    auto& selVector = scanState.nodeIDVector->state->getSelVectorUnsafe();
+    while (true) {
+        const auto offsets = sharedState->getNextBatch(lookupFunc);
+        if (offsets.empty()) {
+            return false;
+        }
+        if (offsets[0] >= StorageConstants::MAX_NUM_ROWS_IN_TABLE) {
+            scanState.source = TableScanSource::UNCOMMITTED;
+            scanState.nodeGroupIdx = StorageUtils::getNodeGroupIdx(
+                offsets[0] - StorageConstants::MAX_NUM_ROWS_IN_TABLE);
+        } else {
+            scanState.source = TableScanSource::COMMITTED;
+            scanState.nodeGroupIdx = StorageUtils::getNodeGroupIdx(offsets[0]);
+        }
+        // All offsets of the batch are in this node group, so its scan state is initialized once.
+        nodeInfo.table->initScanState(transaction, scanState);
+        // Nodes are looked up one at a time, each at its own position of the output. Nodes
+        // deleted, or not yet inserted, as of the transaction are skipped.
+        visiblePositions.clear();
+        for (sel_t pos = 0; pos < offsets.size(); pos++) {
+            scanState.nodeIDVector->setValue<nodeID_t>(pos,
+                nodeID_t{offsets[pos], nodeInfo.table->getTableID()});
+            selVector.setToFiltered(1);
+            selVector[0] = pos;
+            if (nodeInfo.table->lookup(transaction, scanState)) {
+                visiblePositions.push_back(pos);
+            }
+        }
+        if (!visiblePositions.empty()) {
+            selVector.setToFiltered(visiblePositions.size());
+            std::copy(visiblePositions.begin(), visiblePositions.end(),
+                selVector.getMultableBuffer().begin());
+            return true;
+        }
+    }
+}
+
+} // namespace processor
+} // namespace kuzu
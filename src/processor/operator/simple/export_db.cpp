@@ -3,6 +3,7 @@
 #include <sstream>
 
 #include "catalog/catalog.h"
+#include "catalog/catalog_entry/index_catalog_entry.h"
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
 #include "catalog/catalog_entry/rel_group_catalog_entry.h"
 #include "catalog/catalog_entry/rel_table_catalog_entry.h"
@@ -94,6 +95,9 @@ std::string getSchemaCypher(ClientContext* clientContext, Transaction* tx, std::
     for (auto macroName : catalog->getMacroNames(tx)) {
         ss << catalog->getScalarMacroFunction(tx, macroName)->toCypher(macroName) << std::endl;
     }
+    for (const auto indexEntry : catalog->getIndexEntries(tx)) {
+        ss << indexEntry->toCypher(clientContext) << std::endl;
+    }
     return ss.str();
 }
 
@@ -80,13 +80,15 @@ void EvictionQueue::clear(std::atomic<EvictionCandidate>& candidate) {
 }
 
 BufferManager::BufferManager(const std::string& databasePath, const std::string& spillToDiskPath,
-    uint64_t bufferPoolSize, uint64_t maxDBSize, VirtualFileSystem* vfs, bool readOnly)
+    uint64_t bufferPoolSize, uint64_t maxDBSize, VirtualFileSystem* vfs, bool readOnly,
+    bool useHugePages, NumaPolicy numaPolicy)
     : bufferPoolSize{bufferPoolSize}, evictionQueue{bufferPoolSize / PAGE_SIZE},
       usedMemory{evictionQueue.getCapacity() * sizeof(EvictionCandidate)}, vfs{vfs} {
     verifySizeParams(bufferPoolSize, maxDBSize);
     vmRegions.resize(2);
-    vmRegions[0] = std::make_unique<VMRegion>(REGULAR_PAGE, maxDBSize);
-    vmRegions[1] = std::make_unique<VMRegion>(TEMP_PAGE, bufferPoolSize);
+    vmRegions[0] = std::make_unique<VMRegion>(REGULAR_PAGE, maxDBSize, useHugePages, numaPolicy);
+    vmRegions[1] =
+        std::make_unique<VMRegion>(TEMP_PAGE, bufferPoolSize, useHugePages, numaPolicy);
 
     // TODO(bmwinger): It may be better to spill to disk in a different location for remote file
     // systems, or even in general.
@@ -141,12 +143,14 @@ uint8_t* BufferManager::pin(FileHandle& fileHandle, page_idx_t pageIdx,
                     throw BufferManagerException(
                         "Eviction queue is full! This should be impossible.");
                 }
+                fileHandle.numPageMisses.fetch_add(1, std::memory_order_relaxed);
                 return getFrame(fileHandle, pageIdx);
             }
         } break;
         case PageState::UNLOCKED:
         case PageState::MARKED: {
             if (pageState->tryLock(currStateAndVersion)) {
+                fileHandle.numPageHits.fetch_add(1, std::memory_order_relaxed);
                 return getFrame(fileHandle, pageIdx);
             }
         } break;
@@ -217,12 +221,14 @@ inline bool try_func(const std::function<void(uint8_t*)>& func, uint8_t* frame,
 }
 
 void BufferManager::optimisticRead(FileHandle& fileHandle, page_idx_t pageIdx,
-    const std::function<void(uint8_t*)>& func) {
+    const std::function<void(uint8_t*)>& func, PageAccessHint pageAccessHint) {
     auto pageState = fileHandle.getPageState(pageIdx);
 #if defined(_WIN32)
     // Change the Structured Exception handling just for the scope of this function
     auto translator = ScopedTranslator(handleAccessViolation);
 #endif
+    // The pin of an evicted page already counts as a miss.
+    bool countHit = true;
     while (true) {
         auto currStateAndVersion = pageState->getStateAndVersion();
         switch (PageState::getState(currStateAndVersion)) {
@@ -232,10 +238,28 @@ void BufferManager::optimisticRead(FileHandle& fileHandle, page_idx_t pageIdx,
                 continue;
             }
             if (pageState->getStateAndVersion() == currStateAndVersion) {
+                if (countHit) {
+                    fileHandle.numPageHits.fetch_add(1, std::memory_order_relaxed);
+                }
                 return;
             }
         } break;
         case PageState::MARKED: {
+            if (pageAccessHint == PageAccessHint::STREAMING) {
+                // Read the page without clearing the mark, so that it stays evictable. Same as for
+                // unlocked pages, the read is valid if the page was not evicted in the meantime.
+                if (!try_func(func, getFrame(fileHandle, pageIdx), vmRegions,
+                        fileHandle.getPageSizeClass())) {
+                    continue;
+                }
+                if (pageState->getStateAndVersion() == currStateAndVersion) {
+                    if (countHit) {
+                        fileHandle.numPageHits.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    return;
+                }
+                continue;
+            }
             // If the page is marked, we try to switch to unlocked.
             pageState->tryClearMark(currStateAndVersion);
             continue;
@@ -243,6 +267,11 @@ void BufferManager::optimisticRead(FileHandle& fileHandle, page_idx_t pageIdx,
         case PageState::EVICTED: {
             pin(fileHandle, pageIdx, PageReadPolicy::READ_PAGE);
             unpin(fileHandle, pageIdx);
+            countHit = false;
+            if (pageAccessHint == PageAccessHint::STREAMING) {
+                // Pages loaded by streaming reads start marked, i.e. without a second chance.
+                pageState->tryMark(pageState->getStateAndVersion());
+            }
         } break;
         default: {
             // When locked, continue the spinning.
@@ -257,6 +286,78 @@ void BufferManager::unpin(FileHandle& fileHandle, page_idx_t pageIdx) {
     pageState->unlock();
 }
 
+// Prefetching reads runs of consecutive evicted pages with a single read call. This is possible
+// because pages of the same page group are mapped to consecutive frames. Each page of a run is
+// locked first, so concurrent pins of these pages wait for the read instead of issuing their own,
+// and the pages are unlocked (and become evictable) once the read is done.
+// Prefetching is only a hint: pages that are cached or locked by another thread are skipped, at
+// most MAX_PREFETCH_NUM_PAGES pages are read, and it stops if their memory cannot be reserved.
+void BufferManager::prefetchPages(FileHandle& fileHandle, page_idx_t startPageIdx,
+    page_idx_t numPages) {
+    numPages = std::min<page_idx_t>(numPages, BufferPoolConstants::MAX_PREFETCH_NUM_PAGES);
+    const auto endPageIdx = std::min(startPageIdx + numPages, fileHandle.getNumPages());
+    auto pageIdx = startPageIdx;
+    while (pageIdx < endPageIdx) {
+        const auto pageGroupEndIdx = std::min<page_idx_t>(
+            ((pageIdx >> StorageConstants::PAGE_GROUP_SIZE_LOG2) + 1)
+                << StorageConstants::PAGE_GROUP_SIZE_LOG2,
+            endPageIdx);
+        auto runEndIdx = pageIdx;
+        while (runEndIdx < pageGroupEndIdx) {
+            auto pageState = fileHandle.getPageState(runEndIdx);
+            const auto currStateAndVersion = pageState->getStateAndVersion();
+            if (PageState::getState(currStateAndVersion) != PageState::EVICTED ||
+                !pageState->tryLock(currStateAndVersion)) {
+                break;
+            }
+            runEndIdx++;
+        }
+        if (runEndIdx == pageIdx) {
+            pageIdx++;
+            continue;
+        }
+        const auto numPagesInRun = runEndIdx - pageIdx;
+        const auto runSize = static_cast<uint64_t>(numPagesInRun) * PAGE_SIZE;
+        if (!reserve(runSize)) {
+            for (auto i = pageIdx; i < runEndIdx; i++) {
+                fileHandle.getPageState(i)->resetToEvicted();
+            }
+            return;
+        }
+        try {
+#ifdef _WIN32
+            auto result =
+                VirtualAlloc(getFrame(fileHandle, pageIdx), runSize, MEM_COMMIT, PAGE_READWRITE);
+            if (result == NULL) {
+                throw BufferManagerException(stringFormat(
+                    "VirtualAlloc MEM_COMMIT failed with error code {}: {}.", GetLastError(),
+                    std::system_category().message(GetLastError())));
+            }
+#endif
+            fileHandle.getFileInfo()->readFromFile(getFrame(fileHandle, pageIdx), runSize,
+                pageIdx * PAGE_SIZE);
+        } catch (...) {
+            freeUsedMemory(runSize);
+            for (auto i = pageIdx; i < runEndIdx; i++) {
+                fileHandle.getPageState(i)->resetToEvicted();
+            }
+            throw;
+        }
+        for (auto i = pageIdx; i < runEndIdx; i++) {
+            auto pageState = fileHandle.getPageState(i);
+            pageState->clearDirty();
+            if (!evictionQueue.insert(fileHandle.getFileIndex(), i)) {
+                throw BufferManagerException("Eviction queue is full! This should be impossible.");
+            }
+            pageState->unlock();
+            // Prefetched pages are read by streaming scans, so they start marked as well.
+            pageState->tryMark(pageState->getStateAndVersion());
+        }
+        fileHandle.numPrefetchedPages.fetch_add(numPagesInRun, std::memory_order_relaxed);
+        pageIdx = runEndIdx;
+    }
+}
+
 // evicts up to 64 pages and returns the space reclaimed
 uint64_t BufferManager::evictPages() {
     constexpr size_t BATCH_SIZE = 64;
@@ -458,6 +559,15 @@ uint64_t BufferManager::freeUsedMemory(uint64_t size) {
     return usedMemory.fetch_sub(size);
 }
 
+std::vector<FileHandleStats> BufferManager::getFileHandleStats() const {
+    std::vector<FileHandleStats> stats;
+    stats.reserve(fileHandles.size());
+    for (const auto& fileHandle : fileHandles) {
+        stats.push_back(fileHandle->getStats());
+    }
+    return stats;
+}
+
 BufferManager::~BufferManager() = default;
 
 } // namespace storage
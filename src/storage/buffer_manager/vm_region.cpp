@@ -11,6 +11,12 @@
 #include <sys/mman.h>
 #endif
 
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 #include "common/exception/buffer_manager.h"
 
 using namespace kuzu::common;
@@ -18,13 +24,25 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace storage {
 
-VMRegion::VMRegion(PageSizeClass pageSizeClass, uint64_t maxRegionSize) : numFrameGroups{0} {
+VMRegion::VMRegion(PageSizeClass pageSizeClass, uint64_t maxRegionSize, bool useHugePages,
+    NumaPolicy numaPolicy)
+    : numFrameGroups{0}, hugePageBacked{false}, numaPolicyApplied{false} {
     if (maxRegionSize > static_cast<std::size_t>(-1)) {
         throw BufferManagerException("maxRegionSize is beyond the max available mmap region size.");
     }
     frameSize = pageSizeClass == REGULAR_PAGE ? PAGE_SIZE : TEMP_PAGE_SIZE;
     const auto numBytesForFrameGroup = frameSize * StorageConstants::PAGE_GROUP_SIZE;
     maxNumFrameGroups = (maxRegionSize + numBytesForFrameGroup - 1) / numBytesForFrameGroup;
+    reserveRegion(useHugePages);
+    if (useHugePages) {
+        adviseHugePages();
+    }
+    if (numaPolicy != NumaPolicy::DEFAULT) {
+        applyNumaPolicy(numaPolicy);
+    }
+}
+
+void VMRegion::reserveRegion([[maybe_unused]] bool useHugePages) {
 #ifdef _WIN32
     region = (uint8_t*)VirtualAlloc(NULL, getMaxRegionSize(), MEM_RESERVE, PAGE_READWRITE);
     if (region == NULL) {
@@ -35,12 +53,67 @@ VMRegion::VMRegion(PageSizeClass pageSizeClass, uint64_t maxRegionSize) : numFra
 #else
     // Create a private anonymous mapping. The mapping is not shared with other processes and not
     // backed by any file, and its content are initialized to zero.
-    region = static_cast<uint8_t*>(mmap(NULL, getMaxRegionSize(), PROT_READ | PROT_WRITE,
-        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1 /* fd */, 0 /* offset */));
-    if (region == MAP_FAILED) {
+    // The kernel can only back ranges aligned to the huge page size with huge pages, so we
+    // over-reserve by one huge page and unmap the unaligned head and tail.
+    const auto padding = useHugePages ? HUGE_PAGE_SIZE : 0;
+    auto reserved = static_cast<uint8_t*>(mmap(NULL, getMaxRegionSize() + padding,
+        PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1 /* fd */,
+        0 /* offset */));
+    if (reserved == MAP_FAILED) {
         throw BufferManagerException(
             "Mmap for size " + std::to_string(getMaxRegionSize()) + " failed.");
     }
+    region = reserved;
+    if (padding > 0) {
+        const auto address = reinterpret_cast<uintptr_t>(reserved);
+        region = reinterpret_cast<uint8_t*>((address + padding - 1) & ~(padding - 1));
+        const auto headSize = static_cast<uint64_t>(region - reserved);
+        if (headSize > 0) {
+            munmap(reserved, headSize);
+        }
+        if (headSize < padding) {
+            munmap(region + getMaxRegionSize(), padding - headSize);
+        }
+    }
+#endif
+}
+
+void VMRegion::adviseHugePages() {
+#ifdef __linux__
+    // Fails if the kernel is built without transparent huge page support. THP may also be
+    // disabled system-wide, in which case the advice is accepted but has no effect.
+    hugePageBacked = madvise(region, getMaxRegionSize(), MADV_HUGEPAGE) == 0;
+#endif
+}
+
+void VMRegion::applyNumaPolicy([[maybe_unused]] NumaPolicy numaPolicy) {
+#ifdef __linux__
+    // We call the system calls directly instead of linking against libnuma. The node masks are
+    // large enough for the maximum number of nodes the kernel supports (1024).
+    static constexpr uint64_t MAX_NUM_NODES = 1024;
+    static constexpr uint64_t NUM_BITS_PER_WORD = 64;
+    uint64_t nodeMask[MAX_NUM_NODES / NUM_BITS_PER_WORD] = {0};
+    int mode = MPOL_DEFAULT;
+    switch (numaPolicy) {
+    case NumaPolicy::INTERLEAVE: {
+        // Interleave across the nodes the process is allowed to allocate memory on.
+        int currentMode = 0;
+        if (syscall(SYS_get_mempolicy, &currentMode, nodeMask, MAX_NUM_NODES + 1, nullptr,
+                MPOL_F_MEMS_ALLOWED) != 0) {
+            return;
+        }
+        mode = MPOL_INTERLEAVE;
+    } break;
+    case NumaPolicy::LOCAL: {
+        mode = MPOL_LOCAL;
+    } break;
+    default:
+        return;
+    }
+    // Fails with ENOSYS if the kernel is built without NUMA support.
+    numaPolicyApplied = syscall(SYS_mbind, region, getMaxRegionSize(), mode,
+                            mode == MPOL_LOCAL ? nullptr : nodeMask,
+                            mode == MPOL_LOCAL ? 0 : MAX_NUM_NODES + 1, 0 /* flags */) == 0;
 #endif
 }
 
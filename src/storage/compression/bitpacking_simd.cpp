@@ -0,0 +1,259 @@
+#include "storage/compression/bitpacking_simd.h"
+
+#include <array>
+#include <cstring>
+
+#include "common/assert.h"
+#include "fastpfor/bitpackinghelpers.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define KUZU_X86_BITUNPACKING
+#include <immintrin.h>
+#endif
+
+namespace kuzu::storage {
+
+namespace {
+
+template<SIMDUnpackType T>
+void unpackScalar(const uint8_t* in, T* out, uint64_t numChunks, uint8_t bitWidth) {
+    const auto* words = reinterpret_cast<const uint32_t*>(in);
+    for (auto i = 0u; i < numChunks; i++) {
+        FastPForLib::fastunpack(words + i * bitWidth, out + i * SIMDBitUnpacking::CHUNK_SIZE,
+            bitWidth);
+    }
+}
+
+#ifdef KUZU_X86_BITUNPACKING
+
+// The kernels unpack groups of 16 values, which always start on a byte boundary. A group is split
+// into four lanes of 4 values, and each lane is loaded as 16 bytes starting at the byte containing
+// the first bit of its first value. A byte shuffle then moves the 4 bytes holding each value into
+// its own 32-bit element, from where it is shifted and masked into place.
+static constexpr uint64_t GROUP_SIZE = 16;
+static constexpr uint64_t LANE_SIZE = 4;
+static constexpr uint64_t NUM_LANES = GROUP_SIZE / LANE_SIZE;
+
+struct UnpackTable {
+    // Byte offset of each lane from the start of the group
+    std::array<uint32_t, NUM_LANES> laneOffsets;
+    // Shuffle control for each lane, selecting the 4 bytes of each value within the lane
+    std::array<uint8_t, GROUP_SIZE * 4> shuffle;
+    // Number of bits to shift each value right by after shuffling
+    std::array<uint32_t, GROUP_SIZE> shifts;
+    // 2^(7 - shift), to shift with a multiplication where there are no variable shifts (SSE)
+    std::array<uint32_t, GROUP_SIZE> multipliers;
+};
+
+constexpr std::array<UnpackTable, SIMDBitUnpacking::MAX_SIMD_BIT_WIDTH + 1> buildUnpackTables() {
+    std::array<UnpackTable, SIMDBitUnpacking::MAX_SIMD_BIT_WIDTH + 1> tables{};
+    for (uint32_t bitWidth = 1; bitWidth <= SIMDBitUnpacking::MAX_SIMD_BIT_WIDTH; bitWidth++) {
+        auto& table = tables[bitWidth];
+        for (uint32_t lane = 0; lane < NUM_LANES; lane++) {
+            table.laneOffsets[lane] = lane * LANE_SIZE * bitWidth / 8;
+        }
+        for (uint32_t i = 0; i < GROUP_SIZE; i++) {
+            const auto firstBit = i * bitWidth;
+            const auto byteInLane = firstBit / 8 - table.laneOffsets[i / LANE_SIZE];
+            for (uint32_t byte = 0; byte < 4; byte++) {
+                table.shuffle[i * 4 + byte] = static_cast<uint8_t>(byteInLane + byte);
+            }
+            table.shifts[i] = firstBit % 8;
+            table.multipliers[i] = 1u << (7 - firstBit % 8);
+        }
+    }
+    return tables;
+}
+
+constexpr auto UNPACK_TABLES = buildUnpackTables();
+
+// Each kernel unpacks one group into out and returns nothing. The loop around them (unpackGroups)
+// makes sure that the 16 byte loads of the last lane never read past the end of the input.
+struct SSE41Kernel {
+    template<SIMDUnpackType T>
+    __attribute__((target("sse4.1"))) static void unpackGroup(const uint8_t* in, T* out,
+        const UnpackTable& table, uint32_t mask) {
+        const auto maskVec = _mm_set1_epi32(static_cast<int>(mask));
+        for (auto lane = 0u; lane < NUM_LANES; lane++) {
+            auto values = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(in + table.laneOffsets[lane]));
+            values = _mm_shuffle_epi8(values,
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(&table.shuffle[lane * 16])));
+            // (x << (7 - shift)) >> 7 == x >> shift for the bits that are kept by the mask
+            values = _mm_mullo_epi32(values, _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+                                                 &table.multipliers[lane * LANE_SIZE])));
+            values = _mm_and_si128(_mm_srli_epi32(values, 7), maskVec);
+            auto* laneOut = out + lane * LANE_SIZE;
+            if constexpr (std::same_as<T, uint32_t>) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(laneOut), values);
+            } else {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(laneOut), _mm_cvtepu32_epi64(values));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(laneOut + 2),
+                    _mm_cvtepu32_epi64(_mm_srli_si128(values, 8)));
+            }
+        }
+    }
+};
+
+struct AVX2Kernel {
+    template<SIMDUnpackType T>
+    __attribute__((target("avx2"))) static void unpackGroup(const uint8_t* in, T* out,
+        const UnpackTable& table, uint32_t mask) {
+        const auto maskVec = _mm256_set1_epi32(static_cast<int>(mask));
+        for (auto half = 0u; half < 2; half++) {
+            const auto lane = half * 2;
+            auto values = _mm256_loadu2_m128i(
+                reinterpret_cast<const __m128i*>(in + table.laneOffsets[lane + 1]),
+                reinterpret_cast<const __m128i*>(in + table.laneOffsets[lane]));
+            values = _mm256_shuffle_epi8(values,
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&table.shuffle[lane * 16])));
+            values = _mm256_srlv_epi32(values, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(
+                                                   &table.shifts[lane * LANE_SIZE])));
+            values = _mm256_and_si256(values, maskVec);
+            auto* halfOut = out + lane * LANE_SIZE;
+            if constexpr (std::same_as<T, uint32_t>) {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(halfOut), values);
+            } else {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(halfOut),
+                    _mm256_cvtepu32_epi64(_mm256_castsi256_si128(values)));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(halfOut + 4),
+                    _mm256_cvtepu32_epi64(_mm256_extracti128_si256(values, 1)));
+            }
+        }
+    }
+};
+
+struct AVX512Kernel {
+    template<SIMDUnpackType T>
+    __attribute__((target("avx512f,avx512bw"))) static void unpackGroup(const uint8_t* in, T* out,
+        const UnpackTable& table, uint32_t mask) {
+        auto values = _mm512_castsi128_si512(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + table.laneOffsets[0])));
+        values = _mm512_inserti32x4(values,
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + table.laneOffsets[1])), 1);
+        values = _mm512_inserti32x4(values,
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + table.laneOffsets[2])), 2);
+        values = _mm512_inserti32x4(values,
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + table.laneOffsets[3])), 3);
+        values = _mm512_shuffle_epi8(values, _mm512_loadu_si512(table.shuffle.data()));
+        // The zero-masked forms of the intrinsics are used with all lanes enabled, as the unmasked
+        // ones pass an undefined vector which GCC 12 warns about as uninitialized.
+        values = _mm512_maskz_srlv_epi32(0xFFFF, values, _mm512_loadu_si512(table.shifts.data()));
+        values = _mm512_and_si512(values, _mm512_set1_epi32(static_cast<int>(mask)));
+        if constexpr (std::same_as<T, uint32_t>) {
+            _mm512_storeu_si512(out, values);
+        } else {
+            _mm512_storeu_si512(out,
+                _mm512_maskz_cvtepu32_epi64(0xFF, _mm512_castsi512_si256(values)));
+            _mm512_storeu_si512(out + 8, _mm512_maskz_cvtepu32_epi64(0xFF,
+                                             _mm512_maskz_extracti64x4_epi64(0xF, values, 1)));
+        }
+    }
+};
+
+template<typename Kernel, SIMDUnpackType T>
+void unpackGroups(const uint8_t* in, T* out, uint64_t numChunks, uint8_t bitWidth) {
+    const auto& table = UNPACK_TABLES[bitWidth];
+    const uint32_t mask = (1u << bitWidth) - 1;
+    // Each group of 16 values takes up 2 * bitWidth bytes
+    const uint64_t groupSize = 2 * bitWidth;
+    const uint64_t numGroups = numChunks * SIMDBitUnpacking::CHUNK_SIZE / GROUP_SIZE;
+    const uint64_t numBytes = numGroups * groupSize;
+    const uint64_t maxBytesReadPerGroup = table.laneOffsets[NUM_LANES - 1] + 16;
+    uint64_t group = 0;
+    for (; group < numGroups && group * groupSize + maxBytesReadPerGroup <= numBytes; group++) {
+        Kernel::unpackGroup(in + group * groupSize, out + group * GROUP_SIZE, table, mask);
+    }
+    if (group == numGroups) {
+        return;
+    }
+    // The last few groups are read from a copy padded with enough bytes for the last lane.
+    // The remaining input is shorter than maxBytesReadPerGroup, which is at most 1.5 * 25 + 16.
+    alignas(64) uint8_t padded[128]{};
+    const auto numRemainingBytes = numBytes - group * groupSize;
+    KU_ASSERT(numRemainingBytes + 16 <= sizeof(padded));
+    memcpy(padded, in + group * groupSize, numRemainingBytes);
+    for (auto i = 0u; group < numGroups; group++, i++) {
+        Kernel::unpackGroup(padded + i * groupSize, out + group * GROUP_SIZE, table, mask);
+    }
+}
+
+SIMDLevel detectSupportedLevel() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+        return SIMDLevel::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return SIMDLevel::AVX2;
+    }
+    if (__builtin_cpu_supports("sse4.1")) {
+        return SIMDLevel::SSE4_1;
+    }
+    return SIMDLevel::SCALAR;
+}
+
+#else
+
+SIMDLevel detectSupportedLevel() {
+    return SIMDLevel::SCALAR;
+}
+
+#endif
+
+} // namespace
+
+SIMDLevel SIMDBitUnpacking::getSupportedLevel() {
+    static const SIMDLevel supportedLevel = detectSupportedLevel();
+    return supportedLevel;
+}
+
+bool SIMDBitUnpacking::isSupported(SIMDLevel level) {
+    return level <= getSupportedLevel();
+}
+
+std::string_view SIMDBitUnpacking::getLevelName(SIMDLevel level) {
+    switch (level) {
+    case SIMDLevel::SCALAR:
+        return "SCALAR";
+    case SIMDLevel::SSE4_1:
+        return "SSE4.1";
+    case SIMDLevel::AVX2:
+        return "AVX2";
+    case SIMDLevel::AVX512:
+        return "AVX512";
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+template<SIMDUnpackType T>
+void SIMDBitUnpacking::unpack(const uint8_t* in, T* out, uint64_t numChunks, uint8_t bitWidth,
+    SIMDLevel level) {
+    KU_ASSERT(isSupported(level));
+    if (bitWidth == 0 || bitWidth > MAX_SIMD_BIT_WIDTH) {
+        level = SIMDLevel::SCALAR;
+    }
+    switch (level) {
+#ifdef KUZU_X86_BITUNPACKING
+    case SIMDLevel::AVX512:
+        // Widening to 64 bits is faster with the 256-bit kernel
+        if constexpr (std::same_as<T, uint32_t>) {
+            return unpackGroups<AVX512Kernel>(in, out, numChunks, bitWidth);
+        }
+        [[fallthrough]];
+    case SIMDLevel::AVX2:
+        return unpackGroups<AVX2Kernel>(in, out, numChunks, bitWidth);
+    case SIMDLevel::SSE4_1:
+        return unpackGroups<SSE41Kernel>(in, out, numChunks, bitWidth);
+#endif
+    default:
+        return unpackScalar(in, out, numChunks, bitWidth);
+    }
+}
+
+template void SIMDBitUnpacking::unpack<uint32_t>(const uint8_t* in, uint32_t* out,
+    uint64_t numChunks, uint8_t bitWidth, SIMDLevel level);
+template void SIMDBitUnpacking::unpack<uint64_t>(const uint8_t* in, uint64_t* out,
+    uint64_t numChunks, uint8_t bitWidth, SIMDLevel level);
+
+} // namespace kuzu::storage
@@ -1,6 +1,7 @@
 #include "storage/compression/compression.h"
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
 #include <limits>
 #include <string>
@@ -17,8 +18,12 @@
 #include "common/vector/value_vector.h"
 #include "fastpfor/bitpackinghelpers.h"
 #include "storage/compression/bitpacking_int128.h"
+#include "storage/compression/bitpacking_simd.h"
 #include "storage/compression/bitpacking_utils.h"
+#include "storage/compression/delta_compression.h"
 #include "storage/compression/float_compression.h"
+#include "storage/compression/fsst.h"
+#include "storage/compression/rle_compression.h"
 #include "storage/compression/sign_extend.h"
 #include "storage/storage_utils.h"
 #include "storage/store/column_chunk_data.h"
@@ -108,6 +113,42 @@ std::unique_ptr<ExtraMetadata> ALPMetadata::copy() {
     return std::make_unique<ALPMetadata>(*this);
 }
 
+void FSSTMetadata::serialize(Serializer& serializer) const {
+    symbolTable->serialize(serializer);
+}
+
+FSSTMetadata FSSTMetadata::deserialize(Deserializer& deserializer) {
+    return FSSTMetadata(
+        std::make_shared<const FSSTSymbolTable>(FSSTSymbolTable::deserialize(deserializer)));
+}
+
+std::unique_ptr<ExtraMetadata> FSSTMetadata::copy() {
+    return std::make_unique<FSSTMetadata>(*this);
+}
+
+uint64_t RLEMetadata::findRun(offset_t offset) const {
+    KU_ASSERT(!runEnds.empty());
+    const auto run = std::upper_bound(runEnds.begin(), runEnds.end(), offset) - runEnds.begin();
+    return std::min<uint64_t>(run, runEnds.size() - 1);
+}
+
+void RLEMetadata::serialize(Serializer& serializer) const {
+    serializer.serializeVector(runEnds);
+    serializer.serializeVector(runValues);
+}
+
+RLEMetadata RLEMetadata::deserialize(Deserializer& deserializer) {
+    RLEMetadata ret;
+    deserializer.deserializeVector(ret.runEnds);
+    deserializer.deserializeVector(ret.runValues);
+    KU_ASSERT(ret.runEnds.size() == ret.runValues.size());
+    return ret;
+}
+
+std::unique_ptr<ExtraMetadata> RLEMetadata::copy() {
+    return std::make_unique<RLEMetadata>(*this);
+}
+
 CompressionMetadata::CompressionMetadata(StorageValue min, StorageValue max,
     CompressionType compression, const alp::state& state, StorageValue minEncoded,
     StorageValue maxEncoded, common::PhysicalTypeID physicalType)
@@ -154,6 +195,10 @@ void CompressionMetadata::serialize(Serializer& serializer) const {
 
     if (compression == CompressionType::ALP) {
         floatMetadata()->serialize(serializer);
+    } else if (compression == CompressionType::FSST) {
+        fsstMetadata()->serialize(serializer);
+    } else if (compression == CompressionType::RLE) {
+        rleMetadata()->serialize(serializer);
     }
 
     KU_ASSERT(children.size() == getChildCount(compression));
@@ -175,6 +220,10 @@ CompressionMetadata CompressionMetadata::deserialize(common::Deserializer& deser
     if (compressionType == CompressionType::ALP) {
         auto alpMetadata = std::make_unique<ALPMetadata>(ALPMetadata::deserialize(deserializer));
         ret.extraMetadata = std::move(alpMetadata);
+    } else if (compressionType == CompressionType::FSST) {
+        ret.extraMetadata = std::make_unique<FSSTMetadata>(FSSTMetadata::deserialize(deserializer));
+    } else if (compressionType == CompressionType::RLE) {
+        ret.extraMetadata = std::make_unique<RLEMetadata>(RLEMetadata::deserialize(deserializer));
     }
 
     for (size_t i = 0; i < getChildCount(compressionType); ++i) {
@@ -187,12 +236,15 @@ CompressionMetadata CompressionMetadata::deserialize(common::Deserializer& deser
 bool CompressionMetadata::canAlwaysUpdateInPlace() const {
     switch (compression) {
     case CompressionType::BOOLEAN_BITPACKING:
-    case CompressionType::UNCOMPRESSED: {
+    case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST: {
         return true;
     }
     case CompressionType::CONSTANT:
     case CompressionType::ALP:
-    case CompressionType::INTEGER_BITPACKING: {
+    case CompressionType::INTEGER_BITPACKING:
+    case CompressionType::DELTA_FOR:
+    case CompressionType::RLE: {
         return false;
     }
     default: {
@@ -239,9 +291,19 @@ bool CompressionMetadata::canUpdateInPlace(const uint8_t* data, uint32_t pos, ui
         }
     }
     case CompressionType::BOOLEAN_BITPACKING:
-    case CompressionType::UNCOMPRESSED: {
+    case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST: {
         return true;
     }
+    case CompressionType::DELTA_FOR: {
+        // Changing a value also changes the delta of the following value, which may not fit into
+        // the bit width, so chunks are always rewritten.
+        return false;
+    }
+    case CompressionType::RLE: {
+        // The runs are stored in the metadata, which is not modified by in-place updates.
+        return false;
+    }
     case CompressionType::ALP: {
         return TypeUtils::visit(
             physicalType,
@@ -293,10 +355,12 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, const LogicalType& da
 
 uint64_t CompressionMetadata::numValues(uint64_t pageSize, common::PhysicalTypeID dataType) const {
     switch (compression) {
-    case CompressionType::CONSTANT: {
+    case CompressionType::CONSTANT:
+    case CompressionType::RLE: {
         return std::numeric_limits<uint64_t>::max();
     }
-    case CompressionType::UNCOMPRESSED: {
+    case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST: {
         return Uncompressed::numValues(pageSize, dataType);
     }
     case CompressionType::INTEGER_BITPACKING: {
@@ -349,6 +413,18 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, common::PhysicalTypeI
     case CompressionType::BOOLEAN_BITPACKING: {
         return BooleanBitpacking::numValues(pageSize);
     }
+    case CompressionType::DELTA_FOR: {
+        return TypeUtils::visit(
+            dataType,
+            [&](internalID_t) { return DeltaForCompression<uint64_t>::numValues(pageSize, *this); },
+            [&]<DeltaForType T>(T) { return DeltaForCompression<T>::numValues(pageSize, *this); },
+            [&](auto) -> uint64_t {
+                throw common::StorageException(
+                    "Attempted to read from a column chunk which uses delta compression but does "
+                    "not have a supported integer physical type: " +
+                    PhysicalTypeUtils::toString(dataType));
+            });
+    }
     default: {
         throw common::StorageException(
             "Unknown compression type with ID " + std::to_string((uint8_t)compression));
@@ -358,7 +434,8 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, common::PhysicalTypeI
 
 size_t CompressionMetadata::getChildCount(CompressionType compressionType) {
     switch (compressionType) {
-    case CompressionType::ALP: {
+    case CompressionType::ALP:
+    case CompressionType::DELTA_FOR: {
         return 1;
     }
     default: {
@@ -468,6 +545,22 @@ std::string CompressionMetadata::toString(const PhysicalTypeID physicalType) con
     case CompressionType::CONSTANT: {
         return "CONSTANT";
     }
+    case CompressionType::FSST: {
+        return stringFormat("FSST[{} symbols]", fsstMetadata()->symbolTable->getNumSymbols());
+    }
+    case CompressionType::RLE: {
+        return stringFormat("RLE[{} runs]", rleMetadata()->runEnds.size());
+    }
+    case CompressionType::DELTA_FOR: {
+        uint8_t bitWidth = TypeUtils::visit(
+            physicalType,
+            [&](common::internalID_t) {
+                return DeltaForCompression<uint64_t>::getDeltaBitWidth(*this);
+            },
+            [&]<DeltaForType T>(T) { return DeltaForCompression<T>::getDeltaBitWidth(*this); },
+            [](auto) -> uint8_t { KU_UNREACHABLE; });
+        return stringFormat("DELTA_FOR[{}]", bitWidth);
+    }
     default: {
         KU_UNREACHABLE;
     }
@@ -740,6 +833,14 @@ uint64_t IntegerBitpacking<T>::compressNextPage(const uint8_t*& srcBuffer,
         return Uncompressed(sizeof(T)).compressNextPage(srcBuffer, numValuesRemaining, dstBuffer,
             dstBufferSize, metadata);
     }
+    if (metadata.compression == CompressionType::DELTA_FOR) {
+        if constexpr (DeltaForType<T>) {
+            return DeltaForCompression<T>().compressNextPage(srcBuffer, numValuesRemaining,
+                dstBuffer, dstBufferSize, metadata);
+        } else {
+            KU_UNREACHABLE;
+        }
+    }
     KU_ASSERT(metadata.compression == CompressionType::INTEGER_BITPACKING);
     auto info = getPackingInfo(metadata);
     auto bitWidth = info.bitWidth;
@@ -813,9 +914,18 @@ void IntegerBitpacking<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t
         dstIndex += valuesInFirstChunk;
     }
 
-    // Use fastunpack to directly unpack the full-sized chunks
+    // 32 and 64-bit values are unpacked all at once with the SIMD kernels (when supported by the
+    // CPU); other types use fastunpack to directly unpack each full-sized chunk
+    const auto numFullChunks = (dstOffset + numValues - dstIndex) / CHUNK_SIZE;
+    constexpr bool useSIMDUnpacking = SIMDUnpackType<U>;
+    if constexpr (useSIMDUnpacking) {
+        SIMDBitUnpacking::unpack(srcCursor, (U*)dstBuffer + dstIndex, numFullChunks,
+            info.bitWidth);
+    }
     for (; dstIndex + CHUNK_SIZE <= dstOffset + numValues; dstIndex += CHUNK_SIZE) {
-        fastunpack(srcCursor, (U*)dstBuffer + dstIndex, info.bitWidth);
+        if constexpr (!useSIMDUnpacking) {
+            fastunpack(srcCursor, (U*)dstBuffer + dstIndex, info.bitWidth);
+        }
         if (info.hasNegative && info.bitWidth > 0) {
             SignExtend<T, U, CHUNK_SIZE>(dstBuffer + dstIndex * sizeof(U), info.bitWidth);
         }
@@ -833,6 +943,81 @@ void IntegerBitpacking<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t
     }
 }
 
+// Sets the bits of matches for the values within [min, max]
+template<typename T>
+static void setMatches(const T* values, uint64_t numValues, T min, T max, uint64_t* matches,
+    uint64_t posInMatches) {
+    for (auto i = 0u; i < numValues; i++) {
+        if (values[i] >= min && values[i] <= max) {
+            const auto pos = posInMatches + i;
+            matches[pos / 64] |= NULL_BITMASKS_WITH_SINGLE_ONE[pos % 64];
+        }
+    }
+}
+
+template<IntegerBitpackingType T>
+void IntegerBitpacking<T>::filterFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint64_t* matches, uint64_t posInMatches, uint64_t numValues,
+    const CompressionMetadata& metadata, T min, T max) const {
+    if constexpr (std::integral<T>) {
+        auto info = getPackingInfo(metadata);
+        if (info.hasNegative) {
+            std::array<T, CHUNK_SIZE> values{};
+            for (uint64_t pos = 0; pos < numValues; pos += CHUNK_SIZE) {
+                const auto numValuesToCompare = std::min(CHUNK_SIZE, numValues - pos);
+                decompressFromPage(srcBuffer, srcOffset + pos,
+                    reinterpret_cast<uint8_t*>(values.data()), 0, numValuesToCompare, metadata);
+                setMatches(values.data(), numValuesToCompare, min, max, matches,
+                    posInMatches + pos);
+            }
+            return;
+        }
+        // Values are stored as value - offset, which is never negative
+        if (min > max || max < info.offset) {
+            return;
+        }
+        const U packedMin = min <= info.offset ? 0 : static_cast<U>(min) - info.offset;
+        const U packedMax = static_cast<U>(max) - info.offset;
+
+        static constexpr uint64_t NUM_CHUNKS_PER_BATCH = 8;
+        std::array<U, CHUNK_SIZE * NUM_CHUNKS_PER_BATCH> packed{};
+        const auto bytesPerChunk = CHUNK_SIZE / 8 * info.bitWidth;
+        auto srcCursor = getChunkStart(srcBuffer, srcOffset, info.bitWidth);
+        uint64_t pos = 0;
+        while (pos < numValues) {
+            const auto posInChunk = (srcOffset + pos) % CHUNK_SIZE;
+            uint64_t numValuesToCompare = 0;
+            if (posInChunk == 0 && numValues - pos >= CHUNK_SIZE) {
+                const auto numChunks =
+                    std::min((numValues - pos) / CHUNK_SIZE, NUM_CHUNKS_PER_BATCH);
+                if constexpr (SIMDUnpackType<U>) {
+                    SIMDBitUnpacking::unpack(srcCursor, packed.data(), numChunks, info.bitWidth);
+                } else {
+                    for (auto i = 0u; i < numChunks; i++) {
+                        fastunpack(srcCursor + i * bytesPerChunk, packed.data() + i * CHUNK_SIZE,
+                            info.bitWidth);
+                    }
+                }
+                numValuesToCompare = numChunks * CHUNK_SIZE;
+            } else {
+                // Chunks at the edges of the range are only partially read
+                numValuesToCompare = std::min(CHUNK_SIZE - posInChunk, numValues - pos);
+                for (auto i = 0u; i < numValuesToCompare; i++) {
+                    BitpackingUtils<U>::unpackSingle(srcCursor, &packed[i], info.bitWidth,
+                        posInChunk + i);
+                }
+            }
+            setMatches(packed.data(), numValuesToCompare, packedMin, packedMax, matches,
+                posInMatches + pos);
+            srcCursor += (posInChunk + numValuesToCompare) / CHUNK_SIZE * bytesPerChunk;
+            pos += numValuesToCompare;
+        }
+    } else {
+        // Ranges are not supported for int128 columns
+        KU_UNREACHABLE;
+    }
+}
+
 template class IntegerBitpacking<int8_t>;
 template class IntegerBitpacking<int16_t>;
 template class IntegerBitpacking<int32_t>;
@@ -879,6 +1064,25 @@ void BooleanBitpacking::copyFromPage(const uint8_t* srcBuffer, uint64_t srcOffse
         reinterpret_cast<uint64_t*>(dstBuffer), dstOffset, numValues);
 }
 
+static void decompressDeltaFromPage(PhysicalTypeID physicalType, const uint8_t* frame,
+    uint64_t posInPage, uint8_t* result, uint64_t posInResult, uint64_t numValuesToRead,
+    const CompressionMetadata& metadata) {
+    TypeUtils::visit(
+        physicalType,
+        [&](internalID_t) {
+            DeltaForCompression<uint64_t>().decompressFromPage(frame, posInPage, result,
+                posInResult, numValuesToRead, metadata);
+        },
+        [&]<DeltaForType T>(T) {
+            DeltaForCompression<T>().decompressFromPage(frame, posInPage, result, posInResult,
+                numValuesToRead, metadata);
+        },
+        [&](auto) {
+            throw NotImplementedException("DELTA_FOR is not implemented for type " +
+                                          PhysicalTypeUtils::toString(physicalType));
+        });
+}
+
 void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, PageCursor& pageCursor,
     common::ValueVector* resultVector, uint32_t posInVector, uint64_t numValuesToRead,
     const CompressionMetadata& metadata) {
@@ -887,6 +1091,7 @@ void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, Page
         return constant.decompressFromPage(frame, pageCursor.elemPosInPage, resultVector->getData(),
             posInVector, numValuesToRead, metadata);
     case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST:
         return uncompressed.decompressFromPage(frame, pageCursor.elemPosInPage,
             resultVector->getData(), posInVector, numValuesToRead, metadata);
     case CompressionType::ALP: {
@@ -953,6 +1158,13 @@ void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, Page
     case CompressionType::BOOLEAN_BITPACKING:
         return booleanBitpacking.decompressFromPage(frame, pageCursor.elemPosInPage,
             resultVector->getData(), posInVector, numValuesToRead, metadata);
+    case CompressionType::DELTA_FOR:
+        return decompressDeltaFromPage(physicalType, frame, pageCursor.elemPosInPage,
+            resultVector->getData(), posInVector, numValuesToRead, metadata);
+    case CompressionType::RLE:
+        return RunLengthEncoding(physicalType)
+            .decompressFromPage(frame, pageCursor.elemPosInPage, resultVector->getData(),
+                posInVector, numValuesToRead, metadata);
     default:
         KU_UNREACHABLE;
     }
@@ -966,6 +1178,7 @@ void ReadCompressedValuesFromPage::operator()(const uint8_t* frame, PageCursor&
         return constant.copyFromPage(frame, pageCursor.elemPosInPage, result, startPosInResult,
             numValuesToRead, metadata);
     case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST:
         return uncompressed.decompressFromPage(frame, pageCursor.elemPosInPage, result,
             startPosInResult, numValuesToRead, metadata);
     case CompressionType::ALP: {
@@ -1033,11 +1246,86 @@ void ReadCompressedValuesFromPage::operator()(const uint8_t* frame, PageCursor&
         // Reading into ColumnChunks should be done without decompressing for booleans
         return booleanBitpacking.copyFromPage(frame, pageCursor.elemPosInPage, result,
             startPosInResult, numValuesToRead, metadata);
+    case CompressionType::DELTA_FOR:
+        return decompressDeltaFromPage(physicalType, frame, pageCursor.elemPosInPage, result,
+            startPosInResult, numValuesToRead, metadata);
+    case CompressionType::RLE:
+        return RunLengthEncoding(physicalType)
+            .copyFromPage(frame, pageCursor.elemPosInPage, result, startPosInResult,
+                numValuesToRead, metadata);
     default:
         KU_UNREACHABLE;
     }
 }
 
+void FilterCompressedValuesFromPage::operator()(const uint8_t* frame, PageCursor& pageCursor,
+    uint8_t* result, uint32_t startPosInResult, uint64_t numValuesToRead,
+    const CompressionMetadata& metadata) {
+    KU_ASSERT(range.physicalType == physicalType);
+    TypeUtils::visit(
+        physicalType,
+        [&]<std::integral T>(T) {
+            if constexpr (std::same_as<T, bool>) {
+                KU_UNREACHABLE;
+            } else {
+                filterValues<T>(frame, pageCursor, reinterpret_cast<uint64_t*>(result),
+                    startPosInResult, numValuesToRead, metadata);
+            }
+        },
+        [](auto) { KU_UNREACHABLE; });
+}
+
+template<std::integral T>
+void FilterCompressedValuesFromPage::filterValues(const uint8_t* frame, PageCursor& pageCursor,
+    uint64_t* matches, uint32_t startPosInResult, uint64_t numValuesToRead,
+    const CompressionMetadata& metadata) {
+    const auto min = range.min.get<T>();
+    const auto max = range.max.get<T>();
+    const auto inRange = [&](StorageValue value) {
+        return value.get<T>() >= min && value.get<T>() <= max;
+    };
+    switch (metadata.compression) {
+    case CompressionType::CONSTANT: {
+        if (inRange(metadata.min)) {
+            NullMask::setNullRange(matches, startPosInResult, numValuesToRead, true);
+        }
+    } break;
+    case CompressionType::RLE: {
+        RunLengthEncoding::forEachRun(metadata, pageCursor.elemPosInPage, numValuesToRead,
+            [&](StorageValue value, uint64_t pos, uint64_t numValuesInRun) {
+                if (inRange(value)) {
+                    NullMask::setNullRange(matches, startPosInResult + pos, numValuesInRun, true);
+                }
+            });
+    } break;
+    case CompressionType::UNCOMPRESSED: {
+        setMatches(reinterpret_cast<const T*>(frame) + pageCursor.elemPosInPage, numValuesToRead,
+            min, max, matches, startPosInResult);
+    } break;
+    case CompressionType::INTEGER_BITPACKING: {
+        IntegerBitpacking<T>().filterFromPage(frame, pageCursor.elemPosInPage, matches,
+            startPosInResult, numValuesToRead, metadata, min, max);
+    } break;
+    default: {
+        // Other compressions (e.g. DELTA_FOR) are decompressed in small batches. Batches start at
+        // multiples of the batch size in the page, so each DELTA_FOR block is decoded only once.
+        constexpr uint64_t batchSize = 2 * DeltaForCompression<uint64_t>::BLOCK_SIZE;
+        std::array<T, batchSize> values{};
+        auto cursor = pageCursor;
+        for (uint64_t pos = 0; pos < numValuesToRead;) {
+            const auto numValuesToCompare = std::min(batchSize - cursor.elemPosInPage % batchSize,
+                numValuesToRead - pos);
+            readFunc(frame, cursor, reinterpret_cast<uint8_t*>(values.data()), 0,
+                numValuesToCompare, metadata);
+            setMatches(values.data(), numValuesToCompare, min, max, matches,
+                startPosInResult + pos);
+            cursor.elemPosInPage += numValuesToCompare;
+            pos += numValuesToCompare;
+        }
+    }
+    }
+}
+
 void WriteCompressedValuesToPage::operator()(uint8_t* frame, uint16_t posInFrame,
     const uint8_t* data, offset_t dataOffset, offset_t numValues,
     const CompressionMetadata& metadata, const NullMask* nullMask) {
@@ -1046,6 +1334,7 @@ void WriteCompressedValuesToPage::operator()(uint8_t* frame, uint16_t posInFrame
         return constant.setValuesFromUncompressed(data, dataOffset, frame, posInFrame, numValues,
             metadata, nullMask);
     case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST:
         return uncompressed.setValuesFromUncompressed(data, dataOffset, frame, posInFrame,
             numValues, metadata, nullMask);
     case CompressionType::INTEGER_BITPACKING: {
@@ -1079,6 +1368,11 @@ void WriteCompressedValuesToPage::operator()(uint8_t* frame, uint16_t posInFrame
     case CompressionType::BOOLEAN_BITPACKING:
         return booleanBitpacking.copyFromPage(data, dataOffset, frame, posInFrame, numValues,
             metadata);
+    case CompressionType::DELTA_FOR:
+    case CompressionType::RLE:
+        // DELTA_FOR and RLE chunks are never updated in place (see
+        // CompressionMetadata::canUpdateInPlace)
+        KU_UNREACHABLE;
 
     default:
         KU_UNREACHABLE;
@@ -1097,6 +1391,21 @@ void WriteCompressedValuesToPage::operator()(uint8_t* frame, uint16_t posInFrame
     }
 }
 
+std::optional<StorageValueRange> StorageValueRange::getFullRange(PhysicalTypeID physicalType) {
+    return TypeUtils::visit(
+        physicalType,
+        [&]<std::integral T>(T) -> std::optional<StorageValueRange> {
+            if constexpr (std::same_as<T, bool>) {
+                return std::nullopt;
+            } else {
+                return StorageValueRange{physicalType,
+                    StorageValue(std::numeric_limits<T>::min()),
+                    StorageValue(std::numeric_limits<T>::max())};
+            }
+        },
+        [](auto) -> std::optional<StorageValueRange> { return std::nullopt; });
+}
+
 std::optional<StorageValue> StorageValue::readFromVector(const common::ValueVector& vector,
     common::offset_t posInVector) {
     return TypeUtils::visit(
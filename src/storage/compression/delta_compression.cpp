@@ -0,0 +1,157 @@
+#include "storage/compression/delta_compression.h"
+
+#include <array>
+#include <cstring>
+#include <limits>
+
+#include "common/assert.h"
+#include "common/constants.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+template<DeltaForType T>
+std::optional<CompressionMetadata> DeltaForCompression<T>::analyze(std::span<const T> values,
+    const CompressionMetadata& forMetadata) {
+    if (values.size() < 2) {
+        return std::nullopt;
+    }
+    U minDelta = std::numeric_limits<U>::max(), maxDelta = 0;
+    for (auto i = 1u; i < values.size(); i++) {
+        if (values[i] < values[i - 1]) {
+            return std::nullopt;
+        }
+        const U delta = static_cast<U>(values[i]) - static_cast<U>(values[i - 1]);
+        minDelta = std::min(minDelta, delta);
+        maxDelta = std::max(maxDelta, delta);
+    }
+    // Deltas are bitpacked as T, so they must not turn negative
+    if (maxDelta > static_cast<U>(std::numeric_limits<T>::max())) {
+        return std::nullopt;
+    }
+    CompressionMetadata metadata(forMetadata.min, forMetadata.max, CompressionType::DELTA_FOR);
+    metadata.children.emplace_back(StorageValue(static_cast<T>(minDelta)),
+        StorageValue(static_cast<T>(maxDelta)), CompressionType::INTEGER_BITPACKING);
+    const auto forNumValuesPerPage =
+        forMetadata.compression == CompressionType::INTEGER_BITPACKING ?
+            IntegerBitpacking<T>::numValues(PAGE_SIZE, forMetadata) :
+            PAGE_SIZE / sizeof(T);
+    if (numValues(PAGE_SIZE, metadata) <= forNumValuesPerPage) {
+        return std::nullopt;
+    }
+    return metadata;
+}
+
+template<DeltaForType T>
+uint8_t DeltaForCompression<T>::getDeltaBitWidth(const CompressionMetadata& metadata) {
+    return IntegerBitpacking<T>::getPackingInfo(metadata.getChild(DELTA_CHILD_IDX)).bitWidth;
+}
+
+template<DeltaForType T>
+uint64_t DeltaForCompression<T>::numValues(uint64_t dataSize, const CompressionMetadata& metadata) {
+    // With a bit width of 0 every delta is the same and nothing but the anchors are stored.
+    const auto blockSizeInBytes = getBlockSizeInBytes(getDeltaBitWidth(metadata));
+    KU_ASSERT(dataSize >= blockSizeInBytes);
+    return dataSize / blockSizeInBytes * BLOCK_SIZE;
+}
+
+template<DeltaForType T>
+void DeltaForCompression<T>::setValuesFromUncompressed(const uint8_t*, offset_t, uint8_t*,
+    offset_t, offset_t, const CompressionMetadata&, const NullMask*) const {
+    // CompressionMetadata::canUpdateInPlace always returns false for DELTA_FOR
+    KU_UNREACHABLE;
+}
+
+template<DeltaForType T>
+uint64_t DeltaForCompression<T>::compressNextPage(const uint8_t*& srcBuffer,
+    uint64_t numValuesRemaining, uint8_t* dstBuffer, uint64_t dstBufferSize,
+    const CompressionMetadata& metadata) const {
+    KU_ASSERT(metadata.compression == CompressionType::DELTA_FOR);
+    const auto numValuesToCompress =
+        std::min(numValuesRemaining, numValues(dstBufferSize, metadata));
+    const auto* values = reinterpret_cast<const T*>(srcBuffer);
+    const auto& deltaMetadata = metadata.getChild(DELTA_CHILD_IDX);
+    const auto packedDeltasSize = getBlockSizeInBytes(getDeltaBitWidth(metadata)) - sizeof(T);
+    std::array<T, BLOCK_SIZE> deltas{};
+    // Packed into a separate buffer, as IntegerBitpacking requires space for at least one full
+    // bitpacking chunk.
+    std::array<uint8_t, BLOCK_SIZE * sizeof(T)> packedDeltas{};
+    uint64_t sizeCompressed = 0;
+    for (auto blockStart = 0u; blockStart < numValuesToCompress; blockStart += BLOCK_SIZE) {
+        const auto numValuesInBlock =
+            std::min<uint64_t>(BLOCK_SIZE, numValuesToCompress - blockStart);
+        memcpy(dstBuffer + sizeCompressed, values + blockStart, sizeof(T));
+        sizeCompressed += sizeof(T);
+        // The first delta of each block and the deltas past the last value are never read. They
+        // are set to the minimum delta so that they can be packed.
+        deltas.fill(deltaMetadata.min.get<T>());
+        for (auto i = 1u; i < numValuesInBlock; i++) {
+            deltas[i] = static_cast<T>(static_cast<U>(values[blockStart + i]) -
+                                       static_cast<U>(values[blockStart + i - 1]));
+        }
+        if (packedDeltasSize > 0) {
+            const auto* deltaBuffer = reinterpret_cast<const uint8_t*>(deltas.data());
+            IntegerBitpacking<T>().compressNextPage(deltaBuffer, BLOCK_SIZE, packedDeltas.data(),
+                packedDeltas.size(), deltaMetadata);
+            memcpy(dstBuffer + sizeCompressed, packedDeltas.data(), packedDeltasSize);
+            sizeCompressed += packedDeltasSize;
+        }
+    }
+    srcBuffer += numValuesToCompress * sizeof(T);
+    return sizeCompressed;
+}
+
+template<DeltaForType T>
+void DeltaForCompression<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) const {
+    const auto bitWidth = getDeltaBitWidth(metadata);
+    const auto blockSizeInBytes = getBlockSizeInBytes(bitWidth);
+    const auto& deltaMetadata = metadata.getChild(DELTA_CHILD_IDX);
+    auto* dst = reinterpret_cast<T*>(dstBuffer) + dstOffset;
+    std::array<T, BLOCK_SIZE> deltas{};
+    uint64_t numDecompressed = 0;
+    while (numDecompressed < numValues) {
+        const auto posInPage = srcOffset + numDecompressed;
+        const auto* block = srcBuffer + posInPage / BLOCK_SIZE * blockSizeInBytes;
+        const auto posInBlock = posInPage % BLOCK_SIZE;
+        const auto numValuesInBlock =
+            std::min<uint64_t>(BLOCK_SIZE - posInBlock, numValues - numDecompressed);
+        // Values are reconstructed from the anchor of their block, so the deltas before the
+        // requested values in the block are needed too.
+        const auto numDeltas = posInBlock + numValuesInBlock;
+        if (bitWidth == 0) {
+            std::fill_n(deltas.begin(), numDeltas, deltaMetadata.min.get<T>());
+        } else {
+            IntegerBitpacking<T>().decompressFromPage(block + sizeof(T), 0 /*srcOffset*/,
+                reinterpret_cast<uint8_t*>(deltas.data()), 0 /*dstOffset*/, numDeltas,
+                deltaMetadata);
+        }
+        T anchor;
+        memcpy(&anchor, block, sizeof(T));
+        auto value = static_cast<U>(anchor);
+        for (auto i = 1u; i <= posInBlock; i++) {
+            value += static_cast<U>(deltas[i]);
+        }
+        dst[numDecompressed] = static_cast<T>(value);
+        for (auto i = 1u; i < numValuesInBlock; i++) {
+            value += static_cast<U>(deltas[posInBlock + i]);
+            dst[numDecompressed + i] = static_cast<T>(value);
+        }
+        numDecompressed += numValuesInBlock;
+    }
+}
+
+template class DeltaForCompression<int8_t>;
+template class DeltaForCompression<int16_t>;
+template class DeltaForCompression<int32_t>;
+template class DeltaForCompression<int64_t>;
+template class DeltaForCompression<uint8_t>;
+template class DeltaForCompression<uint16_t>;
+template class DeltaForCompression<uint32_t>;
+template class DeltaForCompression<uint64_t>;
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,184 @@
+#include "storage/compression/fsst.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+#include "common/assert.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+// Number of rounds of encoding the sample and picking new symbols. Each round can at most double
+// the length of the symbols, so five rounds are enough to reach the maximum symbol length.
+static constexpr uint8_t NUM_TRAINING_GENERATIONS = 5;
+
+FSSTSymbolTable FSSTSymbolTable::train(const std::vector<std::string_view>& sample) {
+    // Symbols found while encoding the sample are identified by their code, and escaped bytes by
+    // 256 + the byte.
+    static constexpr uint32_t ESCAPED_BYTE_ID_OFFSET = 256;
+    static constexpr uint32_t NUM_IDS = 512;
+    FSSTSymbolTable table;
+    for (auto generation = 0u; generation < NUM_TRAINING_GENERATIONS; generation++) {
+        std::vector<uint64_t> counts(NUM_IDS, 0);
+        std::unordered_map<uint32_t, uint64_t> pairCounts;
+        for (const auto str : sample) {
+            auto prevId = NUM_IDS;
+            auto pos = 0u;
+            while (pos < str.size()) {
+                const auto code = table.findLongestSymbol(str.substr(pos));
+                uint32_t id = code;
+                if (code == ESCAPE_CODE) {
+                    id = ESCAPED_BYTE_ID_OFFSET + static_cast<uint8_t>(str[pos]);
+                    pos++;
+                } else {
+                    pos += table.symbolLengths[code];
+                }
+                counts[id]++;
+                if (prevId != NUM_IDS) {
+                    pairCounts[prevId * NUM_IDS + id]++;
+                }
+                prevId = id;
+            }
+        }
+        auto getSymbol = [&](uint32_t id) {
+            if (id >= ESCAPED_BYTE_ID_OFFSET) {
+                return std::string(1, static_cast<char>(id - ESCAPED_BYTE_ID_OFFSET));
+            }
+            return std::string(reinterpret_cast<const char*>(&table.symbols[id]),
+                table.symbolLengths[id]);
+        };
+        // The gain of a symbol is the number of bytes it covers in the sample. Concatenations of
+        // symbols that follow each other are candidates for longer symbols.
+        std::unordered_map<std::string, uint64_t> gains;
+        for (auto id = 0u; id < NUM_IDS; id++) {
+            if (counts[id] > 0) {
+                auto symbol = getSymbol(id);
+                gains[symbol] += counts[id] * symbol.size();
+            }
+        }
+        for (const auto& [pair, count] : pairCounts) {
+            auto symbol = getSymbol(pair / NUM_IDS) + getSymbol(pair % NUM_IDS);
+            if (symbol.size() <= MAX_SYMBOL_LENGTH) {
+                gains[symbol] += count * symbol.size();
+            }
+        }
+        std::vector<std::pair<std::string, uint64_t>> candidates(gains.begin(), gains.end());
+        std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) {
+            return a.second != b.second ? a.second > b.second : a.first < b.first;
+        });
+        table = FSSTSymbolTable();
+        for (auto i = 0u; i < std::min<size_t>(candidates.size(), MAX_NUM_SYMBOLS); i++) {
+            table.addSymbol(candidates[i].first);
+        }
+        table.buildIndex();
+    }
+    return table;
+}
+
+void FSSTSymbolTable::addSymbol(std::string_view symbol) {
+    KU_ASSERT(numSymbols < MAX_NUM_SYMBOLS);
+    KU_ASSERT(!symbol.empty() && symbol.size() <= MAX_SYMBOL_LENGTH);
+    symbols[numSymbols] = 0;
+    memcpy(&symbols[numSymbols], symbol.data(), symbol.size());
+    symbolLengths[numSymbols] = symbol.size();
+    numSymbols++;
+}
+
+void FSSTSymbolTable::buildIndex() {
+    for (auto& codes : codesByFirstByte) {
+        codes.clear();
+    }
+    for (auto code = 0u; code < numSymbols; code++) {
+        const auto firstByte = *reinterpret_cast<const uint8_t*>(&symbols[code]);
+        codesByFirstByte[firstByte].push_back(code);
+    }
+    for (auto& codes : codesByFirstByte) {
+        std::stable_sort(codes.begin(), codes.end(),
+            [&](uint8_t a, uint8_t b) { return symbolLengths[a] > symbolLengths[b]; });
+    }
+}
+
+uint8_t FSSTSymbolTable::findLongestSymbol(std::string_view str) const {
+    KU_ASSERT(!str.empty());
+    for (const auto code : codesByFirstByte[static_cast<uint8_t>(str[0])]) {
+        const auto length = symbolLengths[code];
+        if (length <= str.size() && memcmp(str.data(), &symbols[code], length) == 0) {
+            return code;
+        }
+    }
+    return ESCAPE_CODE;
+}
+
+uint64_t FSSTSymbolTable::encode(std::string_view str, uint8_t* dst) const {
+    uint64_t numBytesWritten = 0;
+    auto pos = 0u;
+    while (pos < str.size()) {
+        const auto code = findLongestSymbol(str.substr(pos));
+        dst[numBytesWritten++] = code;
+        if (code == ESCAPE_CODE) {
+            dst[numBytesWritten++] = static_cast<uint8_t>(str[pos]);
+            pos++;
+        } else {
+            pos += symbolLengths[code];
+        }
+    }
+    return numBytesWritten;
+}
+
+uint64_t FSSTSymbolTable::decode(const uint8_t* src, uint64_t numBytes, uint8_t* dst) const {
+    uint64_t numBytesWritten = 0;
+    for (auto pos = 0u; pos < numBytes; pos++) {
+        const auto code = src[pos];
+        if (code == ESCAPE_CODE) {
+            KU_ASSERT(pos + 1 < numBytes);
+            dst[numBytesWritten++] = src[++pos];
+        } else {
+            KU_ASSERT(code < numSymbols);
+            memcpy(dst + numBytesWritten, &symbols[code], symbolLengths[code]);
+            numBytesWritten += symbolLengths[code];
+        }
+    }
+    return numBytesWritten;
+}
+
+uint64_t FSSTSymbolTable::getDecodedLength(const uint8_t* src, uint64_t numBytes) const {
+    uint64_t length = 0;
+    for (auto pos = 0u; pos < numBytes; pos++) {
+        if (src[pos] == ESCAPE_CODE) {
+            pos++;
+            length++;
+        } else {
+            length += symbolLengths[src[pos]];
+        }
+    }
+    return length;
+}
+
+void FSSTSymbolTable::serialize(Serializer& serializer) const {
+    serializer.write(numSymbols);
+    for (auto code = 0u; code < numSymbols; code++) {
+        serializer.write(symbolLengths[code]);
+        serializer.write(symbols[code]);
+    }
+}
+
+FSSTSymbolTable FSSTSymbolTable::deserialize(Deserializer& deserializer) {
+    FSSTSymbolTable table;
+    deserializer.deserializeValue(table.numSymbols);
+    KU_ASSERT(table.numSymbols <= MAX_NUM_SYMBOLS);
+    for (auto code = 0u; code < table.numSymbols; code++) {
+        deserializer.deserializeValue(table.symbolLengths[code]);
+        deserializer.deserializeValue(table.symbols[code]);
+    }
+    table.buildIndex();
+    return table;
+}
+
+} // namespace storage
+} // namespace kuzu
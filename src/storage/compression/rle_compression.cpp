@@ -0,0 +1,109 @@
+#include "storage/compression/rle_compression.h"
+
+#include <algorithm>
+
+#include "common/assert.h"
+#include "common/null_mask.h"
+#include "common/type_utils.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+template<typename GetValue>
+static std::optional<RLEMetadata> findRuns(uint64_t numValues, GetValue getValue) {
+    RLEMetadata runs;
+    auto runValue = getValue(0);
+    for (auto i = 1u; i < numValues; i++) {
+        const auto value = getValue(i);
+        if (value == runValue) {
+            continue;
+        }
+        // One more run is needed for the last value
+        if (runs.runEnds.size() + 1 == RunLengthEncoding::MAX_NUM_RUNS) {
+            return std::nullopt;
+        }
+        runs.runEnds.push_back(i);
+        runs.runValues.push_back(StorageValue(runValue));
+        runValue = value;
+    }
+    runs.runEnds.push_back(numValues);
+    runs.runValues.push_back(StorageValue(runValue));
+    return runs;
+}
+
+std::optional<CompressionMetadata> RunLengthEncoding::analyze(const uint8_t* data,
+    uint64_t numValues, PhysicalTypeID physicalType, StorageValue min, StorageValue max) {
+    if (numValues == 0) {
+        return std::nullopt;
+    }
+    std::optional<RLEMetadata> runs;
+    TypeUtils::visit(
+        physicalType,
+        [&](bool) {
+            runs = findRuns(numValues, [&](uint64_t i) {
+                return NullMask::isNull(reinterpret_cast<const uint64_t*>(data), i);
+            });
+        },
+        [&](internalID_t) {
+            runs = findRuns(numValues,
+                [&](uint64_t i) { return reinterpret_cast<const uint64_t*>(data)[i]; });
+        },
+        [&]<numeric_utils::IsIntegral T>(T) {
+            runs = findRuns(numValues,
+                [&](uint64_t i) { return reinterpret_cast<const T*>(data)[i]; });
+        },
+        [](auto) {});
+    if (!runs) {
+        return std::nullopt;
+    }
+    CompressionMetadata metadata(min, max, CompressionType::RLE);
+    metadata.extraMetadata = std::make_unique<RLEMetadata>(std::move(*runs));
+    return metadata;
+}
+
+void RunLengthEncoding::setValuesFromUncompressed(const uint8_t*, offset_t, uint8_t*, offset_t,
+    offset_t, const CompressionMetadata&, const NullMask*) const {
+    // CompressionMetadata::canUpdateInPlace always returns false for RLE
+    KU_UNREACHABLE;
+}
+
+void RunLengthEncoding::decompressFromPage(const uint8_t* /*srcBuffer*/, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) const {
+    TypeUtils::visit(
+        physicalType,
+        [&](internalID_t) {
+            auto* dst = reinterpret_cast<uint64_t*>(dstBuffer) + dstOffset;
+            forEachRun(metadata, srcOffset, numValues,
+                [&](StorageValue value, uint64_t pos, uint64_t numValuesInRun) {
+                    std::fill_n(dst + pos, numValuesInRun, value.get<uint64_t>());
+                });
+        },
+        [&]<numeric_utils::IsIntegral T>(T) {
+            auto* dst = reinterpret_cast<T*>(dstBuffer) + dstOffset;
+            forEachRun(metadata, srcOffset, numValues,
+                [&](StorageValue value, uint64_t pos, uint64_t numValuesInRun) {
+                    std::fill_n(dst + pos, numValuesInRun, value.get<T>());
+                });
+        },
+        [](auto) { KU_UNREACHABLE; });
+}
+
+void RunLengthEncoding::copyFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) const {
+    if (physicalType == PhysicalTypeID::BOOL) {
+        forEachRun(metadata, srcOffset, numValues,
+            [&](StorageValue value, uint64_t pos, uint64_t numValuesInRun) {
+                NullMask::setNullRange(reinterpret_cast<uint64_t*>(dstBuffer), dstOffset + pos,
+                    numValuesInRun, value.get<bool>());
+            });
+    } else {
+        decompressFromPage(srcBuffer, srcOffset, dstBuffer, dstOffset, numValues, metadata);
+    }
+}
+
+} // namespace storage
+} // namespace kuzu
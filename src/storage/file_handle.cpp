@@ -14,7 +14,8 @@ FileHandle::FileHandle(const std::string& path, uint8_t flags, BufferManager* bm
     uint32_t fileIndex, PageSizeClass pageSizeClass, VirtualFileSystem* vfs,
     main::ClientContext* context)
     : flags{flags}, fileIndex{fileIndex}, numPages{0}, pageCapacity{0}, bm{bm},
-      pageSizeClass{pageSizeClass}, pageStates{0, 0}, frameGroupIdxes{0, 0} {
+      pageSizeClass{pageSizeClass}, pageStates{0, 0}, frameGroupIdxes{0, 0}, numPageHits{0},
+      numPageMisses{0}, numPrefetchedPages{0} {
     if (!isNewTmpFile()) {
         constructExistingFileHandle(path, vfs, context);
     } else {
@@ -56,6 +57,8 @@ void FileHandle::constructNewFileHandle(const std::string& path) {
 
 void FileHandle::loadFreeChunkMap(Deserializer& deserializer) const {
     freeChunkMap->deserialize(deserializer);
+    // The file may have been truncated after the free chunk map was persisted.
+    freeChunkMap->removeFreeChunksBeyond(numPages);
 }
 
 void FileHandle::checkpoint(Serializer& serializer) const {
@@ -103,21 +106,38 @@ uint8_t* FileHandle::pinPage(page_idx_t pageIdx, PageReadPolicy readPolicy) {
 }
 
 void FileHandle::optimisticReadPage(page_idx_t pageIdx,
-    const std::function<void(uint8_t*)>& readOp) {
+    const std::function<void(uint8_t*)>& readOp, PageAccessHint pageAccessHint) {
     if (isInMemoryMode()) {
         KU_ASSERT(
             PageState::getState(getPageState(pageIdx)->getStateAndVersion()) == PageState::LOCKED);
         const auto frame = bm->getFrame(*this, pageIdx);
         readOp(frame);
     } else {
-        bm->optimisticRead(*this, pageIdx, readOp);
+        bm->optimisticRead(*this, pageIdx, readOp, pageAccessHint);
     }
 }
 
+FileHandleStats FileHandle::getStats() const {
+    FileHandleStats stats;
+    stats.path = fileInfo->path;
+    stats.numPages = numPages;
+    stats.numPageHits = numPageHits.load(std::memory_order_relaxed);
+    stats.numPageMisses = numPageMisses.load(std::memory_order_relaxed);
+    stats.numPrefetchedPages = numPrefetchedPages.load(std::memory_order_relaxed);
+    return stats;
+}
+
 void FileHandle::unpinPage(page_idx_t pageIdx) {
     bm->unpin(*this, pageIdx);
 }
 
+void FileHandle::prefetchPages(page_idx_t startPageIdx, page_idx_t numPages) {
+    if (isInMemoryMode() || isLargePaged()) {
+        return;
+    }
+    bm->prefetchPages(*this, startPageIdx, numPages);
+}
+
 void FileHandle::resetToZeroPagesAndPageCapacity() {
     removePageIdxAndTruncateIfNecessary(0 /* pageIdx */);
     if (isInMemoryMode()) {
@@ -150,6 +170,15 @@ void FileHandle::removePageIdxAndTruncateIfNecessary(page_idx_t pageIdx) {
     pageCapacity = numPageGroups * StorageConstants::PAGE_GROUP_SIZE;
 }
 
+void FileHandle::truncate(page_idx_t numPagesToKeep) {
+    KU_ASSERT(!isInMemoryMode());
+    for (auto pageIdx = numPagesToKeep; pageIdx < numPages; pageIdx++) {
+        removePageFromFrameIfNecessary(pageIdx);
+    }
+    removePageIdxAndTruncateIfNecessary(numPagesToKeep);
+    fileInfo->truncate(numPagesToKeep * getPageSize());
+}
+
 void FileHandle::removePageFromFrameIfNecessary(page_idx_t pageIdx) {
     bm->removePageFromFrameIfNecessary(*this, pageIdx);
 }
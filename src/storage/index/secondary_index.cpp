@@ -0,0 +1,326 @@
+#include "storage/index/secondary_index.h"
+
+#include <algorithm>
+#include <bit>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/type_utils.h"
+#include "common/vector/value_vector.h"
+#include "storage/index/hash_index_utils.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::common;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace storage {
+
+static constexpr uint64_t SIGN_BIT = 1ull << 63;
+
+// Maps values to keys such that a < b implies key(a) <= key(b).
+template<typename T>
+static uint64_t getOrderedKey(const T& value) {
+    if constexpr (std::same_as<T, ku_string_t>) {
+        // Big-endian prefix of the string, padded with zeros.
+        const auto str = value.getAsStringView();
+        uint64_t key = 0;
+        for (auto i = 0u; i < sizeof(uint64_t); i++) {
+            key <<= 8;
+            if (i < str.size()) {
+                key |= static_cast<uint8_t>(str[i]);
+            }
+        }
+        return key;
+    } else if constexpr (std::same_as<T, int128_t>) {
+        return static_cast<uint64_t>(value.high) ^ SIGN_BIT;
+    } else if constexpr (std::floating_point<T>) {
+        // Negative values have all their bits flipped so that larger magnitudes get smaller keys.
+        // Negative zero is mapped to the key of zero, as they are equal.
+        const auto bits = std::bit_cast<uint64_t>(value == 0 ? 0.0 : static_cast<double>(value));
+        return bits & SIGN_BIT ? ~bits : bits | SIGN_BIT;
+    } else if constexpr (std::signed_integral<T>) {
+        return static_cast<uint64_t>(static_cast<int64_t>(value)) ^ SIGN_BIT;
+    } else {
+        return static_cast<uint64_t>(value);
+    }
+}
+
+static std::vector<SecondaryIndex::Entry> mergeRuns(const std::vector<SecondaryIndex::Entry>& left,
+    const std::vector<SecondaryIndex::Entry>& right) {
+    std::vector<SecondaryIndex::Entry> result(left.size() + right.size());
+    std::merge(left.begin(), left.end(), right.begin(), right.end(), result.begin());
+    return result;
+}
+
+SecondaryIndex::SecondaryIndex(oid_t indexID, SecondaryIndexType indexType,
+    std::string propertyName, PhysicalTypeID keyType, column_id_t columnID, FileHandle& dataFH,
+    ShadowFile* shadowFile, const DiskArrayHeader& header, std::vector<DiskRun> diskRuns)
+    : indexID{indexID}, indexType{indexType}, propertyName{std::move(propertyName)},
+      keyType{keyType}, columnID{columnID}, diskRuns{std::move(diskRuns)},
+      headerForReadTrx{header}, headerForWriteTrx{header} {
+    diskArray = std::make_unique<DiskArray<Entry>>(dataFH, DBFileID::newDataFileID(),
+        headerForReadTrx, headerForWriteTrx, shadowFile);
+}
+
+bool SecondaryIndex::isKeyTypeSupported(PhysicalTypeID keyType) {
+    switch (keyType) {
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::INT128:
+    case PhysicalTypeID::FLOAT:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::STRING:
+        return true;
+    default:
+        return false;
+    }
+}
+
+uint64_t SecondaryIndex::getKey(const ValueVector& keyVector, sel_t pos) const {
+    return TypeUtils::visit(
+        keyType,
+        [&]<IndexHashable T>(T) -> uint64_t {
+            const auto& value = keyVector.getValue<T>(pos);
+            if (indexType == SecondaryIndexType::HASH) {
+                return HashIndexUtils::hash(value);
+            }
+            return getOrderedKey(value);
+        },
+        [](auto) -> uint64_t { KU_UNREACHABLE; });
+}
+
+std::pair<uint64_t, uint64_t> SecondaryIndex::getKeyRange(const ValueVector* lowerBoundVector,
+    const ValueVector* upperBoundVector) const {
+    KU_ASSERT(indexType == SecondaryIndexType::ORDERED || (lowerBoundVector && upperBoundVector));
+    uint64_t lowKey = 0;
+    uint64_t highKey = UINT64_MAX;
+    if (lowerBoundVector) {
+        lowKey = getKey(*lowerBoundVector, lowerBoundVector->state->getSelVector()[0]);
+    }
+    if (upperBoundVector) {
+        highKey = getKey(*upperBoundVector, upperBoundVector->state->getSelVector()[0]);
+    }
+    return {lowKey, highKey};
+}
+
+void SecondaryIndex::appendEntries(const ValueVector& nodeIDVector, const ValueVector& keyVector,
+    std::vector<Entry>& entries) const {
+    const auto& selVector = keyVector.state->getSelVector();
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        const auto pos = selVector[i];
+        if (keyVector.isNull(pos)) {
+            continue;
+        }
+        entries.push_back(Entry{getKey(keyVector, pos), nodeIDVector.readNodeOffset(pos)});
+    }
+}
+
+void SecondaryIndex::insert(const ValueVector& nodeIDVector, const ValueVector& keyVector) {
+    std::vector<Entry> entries;
+    entries.reserve(keyVector.state->getSelVector().getSelSize());
+    appendEntries(nodeIDVector, keyVector, entries);
+    insert(std::move(entries));
+}
+
+void SecondaryIndex::insert(std::vector<Entry> entries) {
+    if (entries.empty()) {
+        return;
+    }
+    std::sort(entries.begin(), entries.end());
+    entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+    std::unique_lock lck{mtx};
+    insertRunNoLock(std::move(entries));
+}
+
+void SecondaryIndex::insertRunNoLock(std::vector<Entry> run) {
+    // Merge with the newer runs until the new run is at most half as large as the previous one.
+    while (!memoryRuns.empty() && memoryRuns.back().size() <= 2 * run.size()) {
+        run = mergeRuns(memoryRuns.back(), run);
+        memoryRuns.pop_back();
+    }
+    memoryRuns.push_back(std::move(run));
+}
+
+void SecondaryIndex::lookup(uint64_t key, std::vector<offset_t>& result) {
+    lookupRange(key, key, result);
+}
+
+void SecondaryIndex::lookupRange(uint64_t lowKey, uint64_t highKey,
+    std::vector<offset_t>& result) {
+    std::shared_lock lck{mtx};
+    for (auto& run : memoryRuns) {
+        auto it = std::lower_bound(run.begin(), run.end(), Entry{lowKey, 0});
+        for (; it != run.end() && it->key <= highKey; ++it) {
+            result.push_back(it->offset);
+        }
+    }
+    for (auto& run : diskRuns) {
+        for (auto idx = lowerBound(run, lowKey); idx < run.startIdx + run.numEntries; idx++) {
+            const auto entry = diskArray->get(idx, &DUMMY_TRANSACTION);
+            if (entry.key > highKey) {
+                break;
+            }
+            result.push_back(entry.offset);
+        }
+    }
+}
+
+uint64_t SecondaryIndex::countRange(uint64_t lowKey, uint64_t highKey) {
+    if (lowKey > highKey) {
+        return 0;
+    }
+    std::shared_lock lck{mtx};
+    uint64_t numEntries = 0;
+    for (auto& run : memoryRuns) {
+        numEntries += std::upper_bound(run.begin(), run.end(), Entry{highKey, INVALID_OFFSET}) -
+                      std::lower_bound(run.begin(), run.end(), Entry{lowKey, 0});
+    }
+    for (auto& run : diskRuns) {
+        const auto end = highKey == UINT64_MAX ? run.startIdx + run.numEntries :
+                                                 lowerBound(run, highKey + 1);
+        numEntries += end - lowerBound(run, lowKey);
+    }
+    return numEntries;
+}
+
+uint64_t SecondaryIndex::getNumEntries() {
+    std::shared_lock lck{mtx};
+    uint64_t numEntries = 0;
+    for (auto& run : memoryRuns) {
+        numEntries += run.size();
+    }
+    for (auto& run : diskRuns) {
+        numEntries += run.numEntries;
+    }
+    return numEntries;
+}
+
+uint64_t SecondaryIndex::lowerBound(const DiskRun& run, uint64_t key) {
+    auto low = run.startIdx;
+    auto high = run.startIdx + run.numEntries;
+    while (low < high) {
+        const auto mid = low + (high - low) / 2;
+        if (diskArray->get(mid, &DUMMY_TRANSACTION).key < key) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+void SecondaryIndex::checkpoint(const std::vector<Entry>& liveEntries) {
+    std::unique_lock lck{mtx};
+    uint64_t numEntries = 0;
+    for (auto& run : memoryRuns) {
+        numEntries += run.size();
+    }
+    for (auto& run : diskRuns) {
+        numEntries += run.numEntries;
+    }
+    // Once more than half of the entries are dead, all runs are rewritten, so that the index stays
+    // at most twice as large as the number of indexed values.
+    const auto mergeAllRuns = numEntries > 2 * liveEntries.size();
+    if (memoryRuns.empty() && !mergeAllRuns) {
+        return;
+    }
+    std::vector<Entry> run;
+    while (!memoryRuns.empty()) {
+        run = mergeRuns(memoryRuns.back(), run);
+        memoryRuns.pop_back();
+    }
+    {
+        auto iter = diskArray->iter_mut();
+        // Read the newest disk runs which aren't more than twice as large into memory and merge
+        // them too. They are overwritten by the merged run.
+        auto startIdx =
+            diskRuns.empty() ? 0 : diskRuns.back().startIdx + diskRuns.back().numEntries;
+        while (!diskRuns.empty() &&
+               (mergeAllRuns || diskRuns.back().numEntries <= 2 * run.size())) {
+            const auto diskRun = diskRuns.back();
+            std::vector<Entry> entries(diskRun.numEntries);
+            for (auto i = 0u; i < diskRun.numEntries; i++) {
+                entries[i] = *iter.seek(diskRun.startIdx + i);
+            }
+            run = mergeRuns(entries, run);
+            startIdx = diskRun.startIdx;
+            diskRuns.pop_back();
+        }
+        // Drop the entries of deleted nodes and of old values. Duplicates are left by nodes whose
+        // value was updated to one with the same key.
+        run.erase(std::unique(run.begin(), run.end()), run.end());
+        std::erase_if(run, [&](const Entry& entry) {
+            return !std::binary_search(liveEntries.begin(), liveEntries.end(), entry);
+        });
+        const auto numElements = diskArray->getNumElements(TransactionType::CHECKPOINT);
+        for (auto i = 0u; i < run.size(); i++) {
+            if (startIdx + i < numElements) {
+                *iter.seek(startIdx + i) = run[i];
+            } else {
+                iter.pushBack(&DUMMY_CHECKPOINT_TRANSACTION, run[i]);
+            }
+        }
+        // Entries past the new run are left over from longer runs it replaced. They are
+        // overwritten by the next run written.
+        if (!run.empty()) {
+            diskRuns.push_back(DiskRun{startIdx, run.size()});
+        }
+    }
+    diskArray->checkpoint();
+    diskArray->checkpointInMemoryIfNecessary();
+    headerForReadTrx = headerForWriteTrx;
+}
+
+std::vector<page_idx_t> SecondaryIndex::getPageIdxs() const {
+    return diskArray->getPageIdxs();
+}
+
+void SecondaryIndex::serialize(Serializer& serializer) const {
+    serializer.writeDebuggingInfo("index_id");
+    serializer.write<oid_t>(indexID);
+    serializer.writeDebuggingInfo("index_type");
+    serializer.write<SecondaryIndexType>(indexType);
+    serializer.writeDebuggingInfo("property_name");
+    serializer.write<std::string>(propertyName);
+    serializer.writeDebuggingInfo("key_type");
+    serializer.write<PhysicalTypeID>(keyType);
+    serializer.writeDebuggingInfo("disk_array_header");
+    serializer.write<DiskArrayHeader>(headerForReadTrx);
+    serializer.writeDebuggingInfo("disk_runs");
+    serializer.serializeVector(diskRuns);
+}
+
+std::unique_ptr<SecondaryIndex> SecondaryIndex::deserialize(Deserializer& deserializer,
+    FileHandle& dataFH, ShadowFile* shadowFile) {
+    std::string key;
+    oid_t indexID = INVALID_OID;
+    auto indexType = SecondaryIndexType::HASH;
+    std::string propertyName;
+    auto keyType = PhysicalTypeID::ANY;
+    DiskArrayHeader header;
+    deserializer.validateDebuggingInfo(key, "index_id");
+    deserializer.deserializeValue<oid_t>(indexID);
+    deserializer.validateDebuggingInfo(key, "index_type");
+    deserializer.deserializeValue<SecondaryIndexType>(indexType);
+    deserializer.validateDebuggingInfo(key, "property_name");
+    deserializer.deserializeValue<std::string>(propertyName);
+    deserializer.validateDebuggingInfo(key, "key_type");
+    deserializer.deserializeValue<PhysicalTypeID>(keyType);
+    deserializer.validateDebuggingInfo(key, "disk_array_header");
+    deserializer.deserializeValue<DiskArrayHeader>(header);
+    std::vector<DiskRun> diskRuns;
+    deserializer.validateDebuggingInfo(key, "disk_runs");
+    deserializer.deserializeVector(diskRuns);
+    return std::make_unique<SecondaryIndex>(indexID, indexType, std::move(propertyName), keyType,
+        INVALID_COLUMN_ID, dataFH, shadowFile, header, std::move(diskRuns));
+}
+
+} // namespace storage
+} // namespace kuzu
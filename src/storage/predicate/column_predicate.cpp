@@ -1,6 +1,7 @@
 #include "storage/predicate/column_predicate.h"
 
 #include "binder/expression/literal_expression.h"
+#include "storage/compression/compression.h"
 #include "storage/predicate/constant_predicate.h"
 
 using namespace kuzu::binder;
@@ -18,6 +19,31 @@ ZoneMapCheckResult ColumnPredicateSet::checkZoneMap(const CompressionMetadata& m
     return ZoneMapCheckResult::ALWAYS_SCAN;
 }
 
+ZoneMapCheckResult ColumnPredicateSet::checkZoneMap(const StringZoneMap& zoneMap) const {
+    for (auto& predicate : predicates) {
+        if (predicate->checkZoneMap(zoneMap) == ZoneMapCheckResult::SKIP_SCAN) {
+            return ZoneMapCheckResult::SKIP_SCAN;
+        }
+    }
+    return ZoneMapCheckResult::ALWAYS_SCAN;
+}
+
+std::optional<StorageValueRange> ColumnPredicateSet::getValueRange(
+    PhysicalTypeID physicalType) const {
+    const auto fullRange = StorageValueRange::getFullRange(physicalType);
+    if (!fullRange) {
+        return std::nullopt;
+    }
+    auto range = *fullRange;
+    for (auto& predicate : predicates) {
+        predicate->narrowRange(range);
+    }
+    if (range.min == fullRange->min && range.max == fullRange->max) {
+        return std::nullopt;
+    }
+    return range;
+}
+
 std::string ColumnPredicateSet::toString() const {
     if (predicates.empty()) {
         return {};
@@ -3,6 +3,7 @@
 #include "common/type_utils.h"
 #include "function/comparison/comparison_functions.h"
 #include "storage/compression/compression.h"
+#include "storage/store/string_zone_map.h"
 
 using namespace kuzu::common;
 using namespace kuzu::function;
@@ -70,6 +71,89 @@ ZoneMapCheckResult ColumnConstantPredicate::checkZoneMap(
         [&](auto) { return ZoneMapCheckResult::ALWAYS_SCAN; });
 }
 
+ZoneMapCheckResult ColumnConstantPredicate::checkZoneMap(const StringZoneMap& zoneMap) const {
+    if (value.isNull() || value.getDataType().getPhysicalType() != PhysicalTypeID::STRING) {
+        return ZoneMapCheckResult::ALWAYS_SCAN;
+    }
+    const auto constant = value.getValue<std::string>();
+    bool mayMatch = true;
+    switch (expressionType) {
+    case ExpressionType::EQUALS: {
+        mayMatch = zoneMap.mayContainEqual(constant);
+    } break;
+    case ExpressionType::GREATER_THAN:
+    case ExpressionType::GREATER_THAN_EQUALS: {
+        mayMatch = zoneMap.mayContainGreaterOrEqual(constant);
+    } break;
+    case ExpressionType::LESS_THAN: {
+        mayMatch = zoneMap.mayContainLess(constant, false /*orEqual*/);
+    } break;
+    case ExpressionType::LESS_THAN_EQUALS: {
+        mayMatch = zoneMap.mayContainLess(constant, true /*orEqual*/);
+    } break;
+    default:
+        // NOT_EQUALS can only rule out chunks with a single distinct value, which the zone map
+        // doesn't tell apart
+        break;
+    }
+    return mayMatch ? ZoneMapCheckResult::ALWAYS_SCAN : ZoneMapCheckResult::SKIP_SCAN;
+}
+
+template<std::integral T>
+static void narrowRangeSwitch(StorageValueRange& range, ExpressionType expressionType,
+    T constant) {
+    auto min = range.min.get<T>();
+    auto max = range.max.get<T>();
+    switch (expressionType) {
+    case ExpressionType::EQUALS: {
+        min = std::max(min, constant);
+        max = std::min(max, constant);
+    } break;
+    case ExpressionType::GREATER_THAN: {
+        if (constant == std::numeric_limits<T>::max()) {
+            // Nothing can be greater, so the range is made empty
+            min = std::numeric_limits<T>::max();
+            max = std::numeric_limits<T>::min();
+        } else {
+            min = std::max(min, static_cast<T>(constant + 1));
+        }
+    } break;
+    case ExpressionType::GREATER_THAN_EQUALS: {
+        min = std::max(min, constant);
+    } break;
+    case ExpressionType::LESS_THAN: {
+        if (constant == std::numeric_limits<T>::min()) {
+            min = std::numeric_limits<T>::max();
+            max = std::numeric_limits<T>::min();
+        } else {
+            max = std::min(max, static_cast<T>(constant - 1));
+        }
+    } break;
+    case ExpressionType::LESS_THAN_EQUALS: {
+        max = std::min(max, constant);
+    } break;
+    default:
+        // NOT_EQUALS excludes a single value, which can't be expressed as a range
+        return;
+    }
+    range.min = StorageValue(min);
+    range.max = StorageValue(max);
+}
+
+void ColumnConstantPredicate::narrowRange(StorageValueRange& range) const {
+    if (value.isNull() || value.getDataType().getPhysicalType() != range.physicalType) {
+        return;
+    }
+    TypeUtils::visit(
+        range.physicalType,
+        [&]<std::integral T>(T) {
+            if constexpr (!std::same_as<T, bool>) {
+                narrowRangeSwitch<T>(range, expressionType, value.getValue<T>());
+            }
+        },
+        [](auto) {});
+}
+
 std::string ColumnConstantPredicate::toString() {
     std::string valStr;
     if (value.getDataType().getPhysicalType() == PhysicalTypeID::STRING ||
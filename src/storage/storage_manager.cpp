@@ -8,6 +8,7 @@
 #include "main/database.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/store/column_chunk_data.h"
 #include "storage/store/node_table.h"
 #include "storage/store/rel_table.h"
 #include "storage/wal_replayer.h"
@@ -22,7 +23,7 @@ namespace storage {
 
 StorageManager::StorageManager(const std::string& databasePath, bool readOnly,
     const Catalog& catalog, MemoryManager& memoryManager, bool enableCompression,
-    VirtualFileSystem* vfs, main::ClientContext* context)
+    std::optional<FreeChunkPolicy> freeChunkPolicy, VirtualFileSystem* vfs, main::ClientContext* context)
     : databasePath{databasePath}, readOnly{readOnly}, memoryManager{memoryManager},
       enableCompression{enableCompression} {
     wal = std::make_unique<WAL>(databasePath, readOnly, vfs, context);
@@ -32,6 +33,10 @@ StorageManager::StorageManager(const std::string& databasePath, bool readOnly,
     metadataFH = initFileHandle(
         StorageUtils::getMetadataFName(vfs, databasePath, FileVersionType::ORIGINAL), vfs, context);
     loadTables(catalog, vfs, context);
+    // An explicitly configured policy replaces the one persisted at the last checkpoint.
+    if (freeChunkPolicy.has_value()) {
+        dataFH->getFreeChunkMap().setPolicy(*freeChunkPolicy);
+    }
 }
 
 FileHandle* StorageManager::initFileHandle(const std::string& fileName, VirtualFileSystem* vfs,
@@ -223,6 +228,9 @@ void StorageManager::checkpoint(main::ClientContext& clientContext) {
         clientContext.getCatalog()->getNodeTableEntries(&DUMMY_CHECKPOINT_TRANSACTION);
     const auto relTableEntries =
         clientContext.getCatalog()->getRelTableEntries(&DUMMY_CHECKPOINT_TRANSACTION);
+    if (clientContext.getDBConfig()->checkpointCompaction) {
+        compactDataFile(*clientContext.getCatalog());
+    }
     const auto numTables = nodeTableEntries.size() + relTableEntries.size();
     ser.writeDebuggingInfo("num_tables");
     ser.write<uint64_t>(numTables);
@@ -232,7 +240,7 @@ void StorageManager::checkpoint(main::ClientContext& clientContext) {
                 stringFormat("Checkpoint failed: table {} not found in storage manager.",
                     tableEntry->getName()));
         }
-        tables.at(tableEntry->getTableID())->checkpoint(ser, tableEntry);
+        tables.at(tableEntry->getTableID())->checkpoint(clientContext, ser, tableEntry);
     }
     for (const auto tableEntry : relTableEntries) {
         if (!tables.contains(tableEntry->getTableID())) {
@@ -240,7 +248,7 @@ void StorageManager::checkpoint(main::ClientContext& clientContext) {
                 stringFormat("Checkpoint failed: table {} not found in storage manager.",
                     tableEntry->getName()));
         }
-        tables.at(tableEntry->getTableID())->checkpoint(ser, tableEntry);
+        tables.at(tableEntry->getTableID())->checkpoint(clientContext, ser, tableEntry);
     }
     dataFH->checkpoint(ser);
     writer->flush();
@@ -248,6 +256,51 @@ void StorageManager::checkpoint(main::ClientContext& clientContext) {
     shadowFile->flushAll();
 }
 
+void StorageManager::finishCheckpoint() {
+    if (main::DBConfig::isDBPathInMemory(databasePath)) {
+        return;
+    }
+    std::lock_guard lck{mtx};
+    auto& freeChunkMap = dataFH->getFreeChunkMap();
+    freeChunkMap.releasePendingFreeChunks();
+    if (freeChunkMap.getPolicy() == FreeChunkPolicy::APPEND_ONLY) {
+        return;
+    }
+    // The free chunk map persisted by the checkpoint may still contain the truncated pages. They are
+    // dropped again when the map is loaded, see FileHandle::loadFreeChunkMap.
+    const auto numPagesToKeep = freeChunkMap.removeTailFreeChunk(dataFH->getNumPages());
+    if (numPagesToKeep < dataFH->getNumPages()) {
+        dataFH->truncate(numPagesToKeep);
+    }
+}
+
+void StorageManager::compactDataFile(const Catalog& catalog) {
+    std::vector<ColumnChunkData*> chunks;
+    for (const auto tableEntry : catalog.getNodeTableEntries(&DUMMY_CHECKPOINT_TRANSACTION)) {
+        if (!tables.contains(tableEntry->getTableID())) {
+            continue;
+        }
+        tables.at(tableEntry->getTableID())
+            ->cast<NodeTable>()
+            .collectOnDiskChunks(*tableEntry, chunks);
+    }
+    // Start from the chunks closest to the end of the file.
+    std::sort(chunks.begin(), chunks.end(), [](const auto* a, const auto* b) {
+        return a->getMetadata().pageIdx > b->getMetadata().pageIdx;
+    });
+    auto& freeChunkMap = dataFH->getFreeChunkMap();
+    for (const auto chunk : chunks) {
+        const auto oldPageIdx = chunk->getMetadata().pageIdx;
+        const auto numPages = chunk->getMetadata().numPages;
+        const auto freeChunk = freeChunkMap.getFreeChunk(numPages, oldPageIdx /* maxPageIdx */);
+        if (freeChunk == nullptr) {
+            continue;
+        }
+        chunk->relocate(*dataFH, freeChunk->pageIdx);
+        freeChunkMap.addFreeChunk(oldPageIdx, numPages);
+    }
+}
+
 StorageManager::~StorageManager() = default;
 
 } // namespace storage
@@ -67,6 +67,18 @@ void DiskArrayInternal::updateLastPageOnDisk() {
     }
 }
 
+std::vector<page_idx_t> DiskArrayInternal::getPageIdxs() const {
+    std::vector<page_idx_t> pageIdxs;
+    for (auto& pip : pips) {
+        pageIdxs.push_back(pip.pipPageIdx);
+    }
+    for (page_idx_t apIdx = 0; apIdx < getNumAPs(header); apIdx++) {
+        pageIdxs.push_back(
+            pips[apIdx / NUM_PAGE_IDXS_PER_PIP].pipContents.pageIdxs[apIdx % NUM_PAGE_IDXS_PER_PIP]);
+    }
+    return pageIdxs;
+}
+
 uint64_t DiskArrayInternal::getNumElements(TransactionType trxType) {
     std::shared_lock sLck{diskArraySharedMtx};
     return getNumElementsNoLock(trxType);
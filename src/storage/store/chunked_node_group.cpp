@@ -195,17 +195,84 @@ void ChunkedNodeGroup::write(const ChunkedNodeGroup& data, column_id_t offsetCol
     }
 }
 
+bool ChunkedNodeGroup::isSkippedByZoneMaps(const TableScanState& scanState) const {
+    for (auto i = 0u; i < scanState.columnPredicateSets.size() && i < scanState.columnIDs.size();
+         i++) {
+        const auto columnID = scanState.columnIDs[i];
+        if (columnID == INVALID_COLUMN_ID || columnID == ROW_IDX_COLUMN_ID ||
+            scanState.columnPredicateSets[i].isEmpty()) {
+            continue;
+        }
+        if (chunks[columnID]->checkZoneMap(scanState.columnPredicateSets[i]) ==
+            ZoneMapCheckResult::SKIP_SCAN) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Prefetches the pages of a chunk scanned sequentially, at most MAX_PREFETCH_NUM_PAGES pages ahead
+// of the rows being scanned. The pages holding a row are estimated from the position of the row in
+// the chunk, as the values of nested chunks (e.g. string data) do not map to rows one to one.
+static void prefetchChunkPages(ChunkState& state, row_idx_t numRows, row_idx_t startRowIdx,
+    row_idx_t endRowIdx) {
+    const auto numPages = state.metadata.numPages;
+    if (state.column != nullptr && numPages > 0 && state.numPrefetchedPages < numPages) {
+        constexpr auto windowSize = BufferPoolConstants::MAX_PREFETCH_NUM_PAGES;
+        const auto startPageIdx = static_cast<page_idx_t>(numPages * startRowIdx / numRows);
+        const auto endPageIdx =
+            static_cast<page_idx_t>((numPages * endRowIdx + numRows - 1) / numRows);
+        // Only prefetch once half of the window has been scanned, so that pages are read in large
+        // batches.
+        if (state.numPrefetchedPages < endPageIdx + windowSize / 2) {
+            const auto prefetchStartIdx = std::max(state.numPrefetchedPages, startPageIdx);
+            const auto prefetchEndIdx =
+                std::min<page_idx_t>(numPages, prefetchStartIdx + windowSize);
+            state.column->getDataFH()->prefetchPages(state.metadata.pageIdx + prefetchStartIdx,
+                prefetchEndIdx - prefetchStartIdx);
+            state.numPrefetchedPages = prefetchEndIdx;
+        }
+    }
+    if (state.nullState) {
+        prefetchChunkPages(*state.nullState, numRows, startRowIdx, endRowIdx);
+    }
+    for (auto& childState : state.childrenStates) {
+        prefetchChunkPages(childState, numRows, startRowIdx, endRowIdx);
+    }
+}
+
 void ChunkedNodeGroup::scan(const Transaction* transaction, const TableScanState& scanState,
-    const NodeGroupScanState& nodeGroupScanState, offset_t rowIdxInGroup,
+    NodeGroupScanState& nodeGroupScanState, offset_t rowIdxInGroup,
     length_t numRowsToScan) const {
     KU_ASSERT(rowIdxInGroup + numRowsToScan <= numRows);
     auto& anchorSelVector = scanState.outState->getSelVectorUnsafe();
+    if (isSkippedByZoneMaps(scanState)) {
+        anchorSelVector.setToFiltered(0);
+        return;
+    }
     if (versionInfo) {
         versionInfo->getSelVectorToScan(transaction->getStartTS(), transaction->getID(),
             anchorSelVector, rowIdxInGroup, numRowsToScan);
     } else {
         anchorSelVector.setToUnfiltered(numRowsToScan);
     }
+    // Evaluate pushed down predicates on the compressed data first, so that only the pages of
+    // other columns which have selected rows are read.
+    for (auto i = 0u; i < scanState.columnPredicateSets.size() && i < scanState.columnIDs.size() &&
+                      anchorSelVector.getSelSize() > 0;
+         i++) {
+        const auto columnID = scanState.columnIDs[i];
+        if (columnID == INVALID_COLUMN_ID || columnID == ROW_IDX_COLUMN_ID ||
+            scanState.columnPredicateSets[i].isEmpty()) {
+            continue;
+        }
+        const auto& chunk = *chunks[columnID];
+        if (const auto range = scanState.columnPredicateSets[i].getValueRange(
+                chunk.getDataType().getPhysicalType())) {
+            chunk.filter(nodeGroupScanState.chunkStates[i], *range, rowIdxInGroup, numRowsToScan,
+                anchorSelVector);
+        }
+    }
     if (anchorSelVector.getSelSize() > 0) {
         for (auto i = 0u; i < scanState.columnIDs.size(); i++) {
             const auto columnID = scanState.columnIDs[i];
@@ -221,8 +288,16 @@ void ChunkedNodeGroup::scan(const Transaction* transaction, const TableScanState
                 continue;
             }
             KU_ASSERT(columnID < chunks.size());
-            chunks[columnID]->scan(transaction, nodeGroupScanState.chunkStates[i],
-                *scanState.outputVectors[i], rowIdxInGroup, numRowsToScan);
+            // Pages are prefetched only after the zone maps and the pushed down predicates have
+            // selected rows of this vector, so that pruned node groups and vectors are not read.
+            auto& chunkState = nodeGroupScanState.chunkStates[i];
+            if (residencyState == ResidencyState::ON_DISK &&
+                chunkState.pageAccessHint == PageAccessHint::STREAMING) {
+                prefetchChunkPages(chunkState, numRows, rowIdxInGroup,
+                    rowIdxInGroup + numRowsToScan);
+            }
+            chunks[columnID]->scan(transaction, chunkState, *scanState.outputVectors[i],
+                rowIdxInGroup, numRowsToScan);
         }
     }
 }
@@ -1,6 +1,7 @@
 #include "storage/store/column.h"
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
 
 #include "common/assert.h"
@@ -182,6 +183,7 @@ ColumnChunkMetadata Column::flushData(const ColumnChunkData& chunkData, FileHand
     // flushed data are not out of the capacity.
     const auto preScanMetadata = chunkData.getMetadataToFlush();
     const auto startPageIdx = dataFH.addNewPages(preScanMetadata.numPages);
+    dataFH.getFreeChunkMap().recordAppendedPages(preScanMetadata.numPages);
     return chunkData.flushBuffer(&dataFH, startPageIdx, preScanMetadata);
 }
 
@@ -270,6 +272,26 @@ void Column::scanInternal(Transaction* transaction, const ChunkState& state,
     }
 }
 
+void Column::filter(const ChunkState& state, offset_t startOffsetInChunk,
+    row_idx_t numValuesToScan, const StorageValueRange& range, SelectionVector& selVector) {
+    KU_ASSERT(numValuesToScan <= DEFAULT_VECTOR_CAPACITY);
+    std::array<uint64_t, DEFAULT_VECTOR_CAPACITY / 64> matches{};
+    if (!range.isEmpty()) {
+        columnReadWriter->readCompressedValuesToPage(&DUMMY_TRANSACTION, state,
+            reinterpret_cast<uint8_t*>(matches.data()), 0, startOffsetInChunk,
+            startOffsetInChunk + numValuesToScan, FilterCompressedValuesFromPage(dataType, range));
+    }
+    auto selectedPositions = selVector.getMultableBuffer();
+    sel_t numSelected = 0;
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        const auto pos = selVector[i];
+        if (NullMask::isNull(matches.data(), pos)) {
+            selectedPositions[numSelected++] = pos;
+        }
+    }
+    selVector.setToFiltered(numSelected);
+}
+
 void Column::lookupValue(Transaction* transaction, const ChunkState& state, offset_t nodeOffset,
     ValueVector* resultVector, uint32_t posInVector) {
     if (nullColumn) {
@@ -6,6 +6,7 @@
 #include "common/vector/value_vector.h"
 #include "main/client_context.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/predicate/column_predicate.h"
 #include "storage/storage_utils.h"
 #include "storage/store/column.h"
 #include "transaction/transaction.h"
@@ -82,6 +83,22 @@ void ColumnChunk::scan(const Transaction* transaction, const ChunkState& state,
     }
 }
 
+void ColumnChunk::filter(const ChunkState& state, const StorageValueRange& range,
+    offset_t offsetInChunk, length_t length, SelectionVector& selVector) const {
+    if (getResidencyState() != ResidencyState::ON_DISK || updateInfo) {
+        return;
+    }
+    state.column->filter(state, offsetInChunk, length, range, selVector);
+}
+
+ZoneMapCheckResult ColumnChunk::checkZoneMap(const ColumnPredicateSet& predicateSet) const {
+    if (getResidencyState() != ResidencyState::ON_DISK || updateInfo ||
+        !data->getMetadata().stringZoneMap) {
+        return ZoneMapCheckResult::ALWAYS_SCAN;
+    }
+    return predicateSet.checkZoneMap(*data->getMetadata().stringZoneMap);
+}
+
 template<ResidencyState SCAN_RESIDENCY_STATE>
 void ColumnChunk::scanCommitted(Transaction* transaction, ChunkState& chunkState,
     ColumnChunk& output, row_idx_t startRow, row_idx_t numRows) const {
@@ -120,7 +120,7 @@ void ColumnChunkData::initializeFunction(bool enableCompression) {
         // Since we compress into memory, storage is the same as fixed-sized
         // values, but we need to mark it as being boolean compressed.
         flushBufferFunction = uncompressedFlushBuffer;
-        getMetadataFunction = booleanGetMetadata;
+        getMetadataFunction = enableCompression ? booleanGetCompressedMetadata : booleanGetMetadata;
     } break;
     case PhysicalTypeID::STRING:
     case PhysicalTypeID::INT64:
@@ -158,6 +158,12 @@ void ColumnChunkData::initializeFunction(bool enableCompression) {
     }
 }
 
+void ColumnChunkData::disableDeltaEncoding() {
+    KU_ASSERT(LogicalTypeUtils::isIntegral(dataType));
+    getMetadataFunction = GetBitpackingMetadata(getCompression(dataType, enableCompression),
+        dataType, false /*enableDeltaEncoding*/);
+}
+
 void ColumnChunkData::resetToAllNull() {
     KU_ASSERT(residencyState != ResidencyState::ON_DISK);
     if (nullData) {
@@ -222,22 +228,20 @@ void ColumnChunkData::flush(FileHandle& dataFH) {
         const std::unique_ptr<FreeChunkEntry> freeChunkEntry =
             freeChunkMap.getFreeChunk(preScanMetadata.numPages);
         if (freeChunkEntry != nullptr) {
-            KU_ASSERT(freeChunkEntry->numPages >= preScanMetadata.numPages);
+            /* FreeChunkMap hands out exactly the number of pages we asked for and keeps the rest */
+            KU_ASSERT(freeChunkEntry->numPages == preScanMetadata.numPages);
             startPageIdx = freeChunkEntry->pageIdx;
-            freeChunkEntry->numPages -= preScanMetadata.numPages;
-            if (freeChunkEntry->numPages != 0) {
-                freeChunkMap.addFreeChunk(freeChunkEntry->pageIdx + preScanMetadata.numPages, freeChunkEntry->numPages);
+            /* Recycled pages may still be cached in the buffer manager with their old content */
+            for (auto i = 0u; i < freeChunkEntry->numPages; i++) {
+                dataFH.removePageFromFrameIfNecessary(startPageIdx + i);
             }
-            /*
-             * There are no more references to the memory location pointed to by freeChunkEntry
-             * above, so the memory will be deallocated automatically outside the if condition.
-             */
         }
     }
 
     /* if no recycled pages to use or given chunk has no physical storage, just allocate new ones here if needed */
     if (startPageIdx == INVALID_PAGE_IDX) {
         startPageIdx = dataFH.addNewPages(preScanMetadata.numPages);
+        dataFH.getFreeChunkMap().recordAppendedPages(preScanMetadata.numPages);
     }
 
     const auto metadata = flushBuffer(&dataFH, startPageIdx, preScanMetadata);
@@ -264,6 +268,37 @@ std::vector<std::pair<page_idx_t, page_idx_t>> ColumnChunkData::getAllChunkPhysi
     return chunkInfo;
 }
 
+void ColumnChunkData::collectOnDiskChunks(std::vector<ColumnChunkData*>& chunks)
+{
+    if (getResidencyState() != ResidencyState::ON_DISK) {
+        return;
+    }
+    if (metadata.pageIdx != INVALID_PAGE_IDX && metadata.numPages != 0) {
+        chunks.push_back(this);
+    }
+    if (nullData) {
+        nullData->collectOnDiskChunks(chunks);
+    }
+}
+
+/*
+ * Move the pages of this chunk to [newPageIdx, newPageIdx + numPages). The destination pages must be free in
+ * the last checkpoint, so that the old metadata stays valid until the new one is durable. The old pages are
+ * left untouched and it is up to the caller to recycle them.
+ */
+void ColumnChunkData::relocate(FileHandle& dataFH, page_idx_t newPageIdx)
+{
+    KU_ASSERT(residencyState == ResidencyState::ON_DISK && metadata.numPages != 0);
+    const auto pageBuffer = std::make_unique<uint8_t[]>(PAGE_SIZE);
+    for (auto i = 0u; i < metadata.numPages; i++) {
+        /* The destination page may still be cached from its previous use */
+        dataFH.removePageFromFrameIfNecessary(newPageIdx + i);
+        dataFH.readPageFromDisk(pageBuffer.get(), metadata.pageIdx + i);
+        dataFH.writePageToFile(pageBuffer.get(), newPageIdx + i);
+    }
+    metadata.pageIdx = newPageIdx;
+}
+
 // Note: This function is not setting child/null chunk data recursively.
 void ColumnChunkData::setToOnDisk(const ColumnChunkMetadata& metadata) {
     residencyState = ResidencyState::ON_DISK;
@@ -276,7 +311,7 @@ void ColumnChunkData::setToOnDisk(const ColumnChunkMetadata& metadata) {
 
 ColumnChunkMetadata ColumnChunkData::flushBuffer(FileHandle* dataFH, page_idx_t startPageIdx,
     const ColumnChunkMetadata& metadata) const {
-    if (!metadata.compMeta.isConstant() && getBufferSize() != 0) {
+    if (!metadata.compMeta.isStoredInMetadata() && getBufferSize() != 0) {
         KU_ASSERT(getBufferSize() == getBufferSize(capacity));
         return flushBufferFunction(buffer->getBuffer(), dataFH, startPageIdx, metadata);
     }
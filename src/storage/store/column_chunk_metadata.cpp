@@ -7,7 +7,9 @@
 #include "common/serializer/serializer.h"
 #include "common/type_utils.h"
 #include "common/utils.h"
+#include "storage/compression/delta_compression.h"
 #include "storage/compression/float_compression.h"
+#include "storage/compression/rle_compression.h"
 #include "storage/store/column_chunk_data.h"
 
 namespace kuzu::storage {
@@ -34,11 +36,24 @@ ColumnChunkMetadata booleanGetMetadata(std::span<const uint8_t> buffer, uint64_t
         CompressionMetadata(min, max, CompressionType::BOOLEAN_BITPACKING));
 }
 
+ColumnChunkMetadata booleanGetCompressedMetadata(std::span<const uint8_t> buffer,
+    uint64_t capacity, uint64_t numValues, StorageValue min, StorageValue max) {
+    if (auto rleMeta = RunLengthEncoding::analyze(buffer.data(), numValues, PhysicalTypeID::BOOL,
+            min, max)) {
+        return ColumnChunkMetadata(INVALID_PAGE_IDX, 0, numValues, *rleMeta);
+    }
+    return booleanGetMetadata(buffer, capacity, numValues, min, max);
+}
+
 void ColumnChunkMetadata::serialize(common::Serializer& serializer) const {
     serializer.write(pageIdx);
     serializer.write(numPages);
     serializer.write(numValues);
     compMeta.serialize(serializer);
+    serializer.write<bool>(stringZoneMap != nullptr);
+    if (stringZoneMap) {
+        stringZoneMap->serialize(serializer);
+    }
 }
 
 ColumnChunkMetadata ColumnChunkMetadata::deserialize(common::Deserializer& deserializer) {
@@ -47,11 +62,17 @@ ColumnChunkMetadata ColumnChunkMetadata::deserialize(common::Deserializer& deser
     deserializer.deserializeValue(ret.numPages);
     deserializer.deserializeValue(ret.numValues);
     ret.compMeta = decltype(ret.compMeta)::deserialize(deserializer);
+    bool hasStringZoneMap = false;
+    deserializer.deserializeValue(hasStringZoneMap);
+    if (hasStringZoneMap) {
+        ret.stringZoneMap =
+            std::make_shared<StringZoneMap>(StringZoneMap::deserialize(deserializer));
+    }
 
     return ret;
 }
 
-ColumnChunkMetadata GetBitpackingMetadata::operator()(std::span<const uint8_t> /*buffer*/,
+ColumnChunkMetadata GetBitpackingMetadata::operator()(std::span<const uint8_t> buffer,
     uint64_t capacity, uint64_t numValues, StorageValue min, StorageValue max) {
     // For supported types, min and max may be null if all values are null
     // Compression is supported in this case
@@ -63,6 +84,11 @@ ColumnChunkMetadata GetBitpackingMetadata::operator()(std::span<const uint8_t> /
     }
     auto compMeta = CompressionMetadata(min, max, alg->getCompressionType());
     if (alg->getCompressionType() == CompressionType::INTEGER_BITPACKING) {
+        // Chunks with few runs (e.g. low-cardinality values loaded in order) need no pages at all
+        if (auto rleMeta = RunLengthEncoding::analyze(buffer.data(), numValues,
+                dataType.getPhysicalType(), min, max)) {
+            return ColumnChunkMetadata(INVALID_PAGE_IDX, 0, numValues, *rleMeta);
+        }
         TypeUtils::visit(
             dataType.getPhysicalType(),
             [&]<IntegerBitpackingType T>(T) {
@@ -73,6 +99,18 @@ ColumnChunkMetadata GetBitpackingMetadata::operator()(std::span<const uint8_t> /
                 }
             },
             [&](auto) {});
+        // Sorted chunks (e.g. CSR offsets) are usually stored much more compactly as deltas
+        auto analyzeDelta = [&]<DeltaForType T>(T) {
+            if (auto deltaMeta = DeltaForCompression<T>::analyze(
+                    std::span(reinterpret_cast<const T*>(buffer.data()), numValues), compMeta)) {
+                compMeta = std::move(*deltaMeta);
+            }
+        };
+        if (enableDeltaEncoding) {
+            TypeUtils::visit(
+                dataType.getPhysicalType(), [&](internalID_t) { analyzeDelta(uint64_t()); },
+                [&]<DeltaForType T>(T) { analyzeDelta(T()); }, [&](auto) {});
+        }
     }
     const auto numValuesPerPage = compMeta.numValues(PAGE_SIZE, dataType);
     const auto numPages =
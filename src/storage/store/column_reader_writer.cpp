@@ -18,7 +18,7 @@ using namespace transaction;
 namespace {
 [[maybe_unused]] bool isPageIdxValid(page_idx_t pageIdx, const ColumnChunkMetadata& metadata) {
     return (metadata.pageIdx <= pageIdx && pageIdx < metadata.pageIdx + metadata.numPages) ||
-           (pageIdx == INVALID_PAGE_IDX && metadata.compMeta.isConstant());
+           (pageIdx == INVALID_PAGE_IDX && metadata.compMeta.isStoredInMetadata());
 }
 
 template<typename T, typename InputType, typename ElementType>
@@ -185,10 +185,13 @@ public:
             KU_ASSERT(isPageIdxValid(pageCursor.pageIdx, chunkMeta));
             if (!filterFunc.has_value() ||
                 filterFunc.value()(numValuesScanned, numValuesScanned + numValuesToScanInPage)) {
-                readFromPage(transaction, pageCursor.pageIdx, [&](uint8_t* frame) -> void {
-                    readFunc(frame, pageCursor, result, numValuesScanned + startOffsetInResult,
-                        numValuesToScanInPage, chunkMeta.compMeta);
-                });
+                readFromPage(
+                    transaction, pageCursor.pageIdx,
+                    [&](uint8_t* frame) -> void {
+                        readFunc(frame, pageCursor, result, numValuesScanned + startOffsetInResult,
+                            numValuesToScanInPage, chunkMeta.compMeta);
+                    },
+                    state.pageAccessHint);
             }
             numValuesScanned += numValuesToScanInPage;
             pageCursor.nextPage();
@@ -409,7 +412,7 @@ ColumnReadWriter::ColumnReadWriter(DBFileID dbFileID, FileHandle* dataFH,
     : dbFileID(dbFileID), dataFH(dataFH), bufferManager(bufferManager), shadowFile(shadowFile) {}
 
 void ColumnReadWriter::readFromPage(Transaction* transaction, page_idx_t pageIdx,
-    const std::function<void(uint8_t*)>& readFunc) {
+    const std::function<void(uint8_t*)>& readFunc, PageAccessHint pageAccessHint) {
     // For constant compression, call read on a nullptr since there is no data on disk and
     // decompression only requires metadata
     if (pageIdx == INVALID_PAGE_IDX) {
@@ -417,7 +420,7 @@ void ColumnReadWriter::readFromPage(Transaction* transaction, page_idx_t pageIdx
     }
     auto [fileHandleToPin, pageIdxToPin] = ShadowUtils::getFileHandleAndPhysicalPageIdxToPin(
         *dataFH, pageIdx, *shadowFile, transaction->getType());
-    fileHandleToPin->optimisticReadPage(pageIdxToPin, readFunc);
+    fileHandleToPin->optimisticReadPage(pageIdxToPin, readFunc, pageAccessHint);
 }
 
 void ColumnReadWriter::updatePageWithCursor(PageCursor cursor,
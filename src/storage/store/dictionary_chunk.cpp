@@ -3,6 +3,7 @@
 #include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/compression/fsst.h"
 #include "storage/enums/residency_state.h"
 #include <bit>
 
@@ -19,6 +20,8 @@ namespace storage {
 // So the chunk is initialized with a size equal to 3/4 the node group size, making sure there
 // is always extra space for updates.
 static constexpr double OFFSET_CHUNK_CAPACITY_FACTOR = 0.75;
+// FSST symbol tables are trained on roughly this many bytes of strings.
+static constexpr uint64_t FSST_SAMPLE_SIZE = 16 * 1024;
 
 DictionaryChunk::DictionaryChunk(MemoryManager& mm, uint64_t capacity, bool enableCompression,
     ResidencyState residencyState)
@@ -30,6 +33,8 @@ DictionaryChunk::DictionaryChunk(MemoryManager& mm, uint64_t capacity, bool enab
     offsetChunk =
         ColumnChunkFactory::createColumnChunkData(mm, LogicalType::UINT64(), enableCompression,
             capacity * OFFSET_CHUNK_CAPACITY_FACTOR, residencyState, false /*hasNullData*/);
+    // New strings are appended to the dictionary in place, which DELTA_FOR does not allow.
+    offsetChunk->disableDeltaEncoding();
 }
 
 void DictionaryChunk::resetToEmpty() {
@@ -100,10 +105,102 @@ uint64_t DictionaryChunk::getEstimatedMemoryUsage() const {
 }
 
 void DictionaryChunk::flush(FileHandle& dataFH) {
+    if (auto encoded = encodeWithFSST()) {
+        // The chunks are not used in memory after being flushed, so they can be replaced.
+        indexTable.clear();
+        stringDataChunk = std::move(encoded->stringDataChunk);
+        offsetChunk = std::move(encoded->offsetChunk);
+        stringDataChunk->flush(dataFH);
+        offsetChunk->flush(dataFH);
+        setFSSTMetadata(*stringDataChunk, std::move(encoded->symbolTable));
+        return;
+    }
     stringDataChunk->flush(dataFH);
     offsetChunk->flush(dataFH);
 }
 
+std::optional<DictionaryChunk::FSSTEncodedData> DictionaryChunk::encodeWithFSST() const {
+    const auto numStrings = offsetChunk->getNumValues();
+    const auto dataSize = stringDataChunk->getNumValues();
+    // String data that fits into a single page cannot get any smaller on disk.
+    if (!enableCompression || numStrings == 0 || dataSize <= PAGE_SIZE) {
+        return std::nullopt;
+    }
+    std::vector<std::string_view> sample;
+    const auto stride = std::max<uint64_t>(1, dataSize / FSST_SAMPLE_SIZE);
+    for (auto i = 0u; i < numStrings; i += stride) {
+        sample.push_back(getString(i));
+    }
+    auto symbolTable =
+        std::make_shared<const FSSTSymbolTable>(FSSTSymbolTable::train(sample));
+    // Each string is stored exactly once, so the string data holds all strings back to back.
+    std::vector<uint8_t> encodedData(FSSTSymbolTable::getMaxEncodedLength(dataSize));
+    std::vector<string_offset_t> encodedOffsets(numStrings);
+    uint64_t encodedSize = 0;
+    for (auto i = 0u; i < numStrings; i++) {
+        encodedOffsets[i] = encodedSize;
+        encodedSize += symbolTable->encode(getString(i), encodedData.data() + encodedSize);
+    }
+    const auto encodedCapacity = std::bit_ceil(encodedSize);
+    if (ColumnChunkData::getNumPagesForBytes(encodedCapacity) >=
+        ColumnChunkData::getNumPagesForBytes(stringDataChunk->getCapacity())) {
+        return std::nullopt;
+    }
+    // Identical bytes would be flushed with constant compression, which cannot keep the symbol
+    // table.
+    if (std::all_of(encodedData.begin(), encodedData.begin() + encodedSize,
+            [&](uint8_t byte) { return byte == encodedData[0]; })) {
+        return std::nullopt;
+    }
+    auto& mm = stringDataChunk->getMemoryManager();
+    FSSTEncodedData encoded;
+    encoded.stringDataChunk = ColumnChunkFactory::createColumnChunkData(mm, LogicalType::UINT8(),
+        false /*enableCompression*/, encodedCapacity, ResidencyState::IN_MEMORY,
+        false /*hasNullData*/);
+    memcpy(encoded.stringDataChunk->getData(), encodedData.data(), encodedSize);
+    encoded.stringDataChunk->setNumValues(encodedSize);
+    encoded.offsetChunk = ColumnChunkFactory::createColumnChunkData(mm, LogicalType::UINT64(),
+        enableCompression, offsetChunk->getCapacity(), ResidencyState::IN_MEMORY,
+        false /*hasNullData*/);
+    encoded.offsetChunk->disableDeltaEncoding();
+    for (auto i = 0u; i < numStrings; i++) {
+        encoded.offsetChunk->setValue<string_offset_t>(encodedOffsets[i], i);
+    }
+    encoded.offsetChunk->setNumValues(numStrings);
+    encoded.symbolTable = std::move(symbolTable);
+    return encoded;
+}
+
+void DictionaryChunk::decodeFSST(const FSSTSymbolTable& symbolTable) {
+    const auto numStrings = offsetChunk->getNumValues();
+    const auto encodedSize = stringDataChunk->getNumValues();
+    const std::vector<uint8_t> encodedData(stringDataChunk->getData(),
+        stringDataChunk->getData() + encodedSize);
+    const auto decodedSize = symbolTable.getDecodedLength(encodedData.data(), encodedSize);
+    if (decodedSize > stringDataChunk->getCapacity()) {
+        stringDataChunk->resize(std::bit_ceil(decodedSize));
+    }
+    uint64_t numBytesDecoded = 0;
+    for (auto i = 0u; i < numStrings; i++) {
+        const auto startOffset = offsetChunk->getValue<string_offset_t>(i);
+        const auto endOffset =
+            i + 1 < numStrings ? offsetChunk->getValue<string_offset_t>(i + 1) : encodedSize;
+        KU_ASSERT(endOffset >= startOffset);
+        offsetChunk->setValue<string_offset_t>(numBytesDecoded, i);
+        numBytesDecoded += symbolTable.decode(encodedData.data() + startOffset,
+            endOffset - startOffset, stringDataChunk->getData() + numBytesDecoded);
+    }
+    stringDataChunk->setNumValues(numBytesDecoded);
+}
+
+void DictionaryChunk::setFSSTMetadata(ColumnChunkData& flushedStringDataChunk,
+    std::shared_ptr<const FSSTSymbolTable> symbolTable) {
+    auto& compMeta = flushedStringDataChunk.getMetadata().compMeta;
+    KU_ASSERT(compMeta.compression == CompressionType::UNCOMPRESSED);
+    compMeta.compression = CompressionType::FSST;
+    compMeta.extraMetadata = std::make_unique<FSSTMetadata>(std::move(symbolTable));
+}
+
 void DictionaryChunk::serialize(Serializer& serializer) const {
     serializer.writeDebuggingInfo("offset_chunk");
     offsetChunk->serialize(serializer);
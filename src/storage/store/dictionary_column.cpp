@@ -5,6 +5,7 @@
 #include "common/types/ku_string.h"
 #include "common/vector/value_vector.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/compression/fsst.h"
 #include "storage/storage_structure/disk_array_collection.h"
 #include "storage/store/string_column.h"
 #include <bit>
@@ -49,6 +50,10 @@ void DictionaryColumn::scan(Transaction* transaction, const ChunkState& state,
     }
     offsetColumn->scan(transaction,
         StringColumn::getChildState(state, StringColumn::ChildStateIndex::OFFSET), offsetChunk);
+    if (const auto* fsstMetadata = dataMetadata.compMeta.fsstMetadata()) {
+        // In memory the dictionary always holds the decoded strings.
+        dictChunk.decodeFSST(*fsstMetadata->symbolTable);
+    }
 }
 
 void DictionaryColumn::scan(Transaction* transaction, const ChunkState& offsetState,
@@ -100,9 +105,17 @@ void DictionaryColumn::scan(Transaction* transaction, const ChunkState& offsetSt
 
 string_index_t DictionaryColumn::append(const DictionaryChunk& dictChunk, ChunkState& state,
     std::string_view val) {
-    const auto startOffset = dataColumn->appendValues(*dictChunk.getStringDataChunk(),
-        StringColumn::getChildState(state, StringColumn::ChildStateIndex::DATA),
-        reinterpret_cast<const uint8_t*>(val.data()), nullptr /*nullChunkData*/, val.size());
+    auto& dataState = StringColumn::getChildState(state, StringColumn::ChildStateIndex::DATA);
+    // Strings appended to FSST encoded string data must be encoded with the same symbol table.
+    std::vector<uint8_t> encodedVal;
+    if (const auto* fsstMetadata = dataState.metadata.compMeta.fsstMetadata()) {
+        encodedVal.resize(FSSTSymbolTable::getMaxEncodedLength(val.size()));
+        encodedVal.resize(fsstMetadata->symbolTable->encode(val, encodedVal.data()));
+        val = std::string_view(reinterpret_cast<const char*>(encodedVal.data()), encodedVal.size());
+    }
+    const auto startOffset =
+        dataColumn->appendValues(*dictChunk.getStringDataChunk(), dataState,
+            reinterpret_cast<const uint8_t*>(val.data()), nullptr /*nullChunkData*/, val.size());
     return offsetColumn->appendValues(*dictChunk.getOffsetChunk(),
         StringColumn::getChildState(state, StringColumn::ChildStateIndex::OFFSET),
         reinterpret_cast<const uint8_t*>(&startOffset), nullptr /*nullChunkData*/, 1 /*numValues*/);
@@ -124,6 +137,19 @@ void DictionaryColumn::scanOffsets(Transaction* transaction, const ChunkState& s
 void DictionaryColumn::scanValueToVector(Transaction* transaction, const ChunkState& dataState,
     uint64_t startOffset, uint64_t endOffset, ValueVector* resultVector, uint64_t offsetInVector) {
     KU_ASSERT(endOffset >= startOffset);
+    if (const auto* fsstMetadata = dataState.metadata.compMeta.fsstMetadata()) {
+        // Each string is encoded on its own, so it can be decoded without touching its neighbours.
+        std::vector<uint8_t> encoded(endOffset - startOffset);
+        dataColumn->scan(transaction, dataState, startOffset, endOffset, encoded.data());
+        const auto& symbolTable = *fsstMetadata->symbolTable;
+        auto& kuString = StringVector::reserveString(resultVector, offsetInVector,
+            symbolTable.getDecodedLength(encoded.data(), encoded.size()));
+        symbolTable.decode(encoded.data(), encoded.size(), (uint8_t*)kuString.getData());
+        if (!ku_string_t::isShortString(kuString.len)) {
+            memcpy(kuString.prefix, kuString.getData(), ku_string_t::PREFIX_LENGTH);
+        }
+        return;
+    }
     // Add string to vector first and read directly into the vector
     auto& kuString =
         StringVector::reserveString(resultVector, offsetInVector, endOffset - startOffset);
@@ -152,7 +178,11 @@ bool DictionaryColumn::canCommitInPlace(const ChunkState& state, uint64_t numNew
 
 bool DictionaryColumn::canDataCommitInPlace(const ChunkState& dataState,
     uint64_t totalStringLengthToAdd) {
-    // Make sure there is sufficient space in the data chunk (not currently compressed)
+    // Make sure there is sufficient space in the data chunk (not currently compressed, apart from
+    // FSST, where the new strings are assumed to be encoded to their maximum size)
+    if (dataState.metadata.compMeta.compression == CompressionType::FSST) {
+        totalStringLengthToAdd = FSSTSymbolTable::getMaxEncodedLength(totalStringLengthToAdd);
+    }
     auto totalStringDataAfterUpdate = dataState.metadata.numValues + totalStringLengthToAdd;
     if (totalStringDataAfterUpdate > dataState.metadata.numPages * PAGE_SIZE) {
         // Data cannot be updated in place
@@ -163,6 +193,9 @@ bool DictionaryColumn::canDataCommitInPlace(const ChunkState& dataState,
 
 bool DictionaryColumn::canOffsetCommitInPlace(const ChunkState& offsetState,
     const ChunkState& dataState, uint64_t numNewStrings, uint64_t totalStringLengthToAdd) {
+    if (dataState.metadata.compMeta.compression == CompressionType::FSST) {
+        totalStringLengthToAdd = FSSTSymbolTable::getMaxEncodedLength(totalStringLengthToAdd);
+    }
     auto totalStringOffsetsAfterUpdate = dataState.metadata.numValues + totalStringLengthToAdd;
     auto offsetCapacity =
         offsetState.metadata.compMeta.numValues(PAGE_SIZE, dataColumn->getDataType()) *
@@ -1,10 +1,12 @@
 #include "storage/store/free_chunk_map.h"
 
+#include <algorithm>
+#include <bit>
+#include <chrono>
 
 #include "common/assert.h"
 #include "common/constants.h"
 #include "common/types/types.h"
-#include "main/client_context.h"
 #include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
 using namespace kuzu::common;
@@ -12,181 +14,248 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace storage {
 
-FreeChunkMap::FreeChunkMap()
-    :maxAvailLevel(INVALID_FREE_CHUNK_LEVEL) {
-    /* we initialize our vector as nullptr vector by default */
-    for (int i = 0; i < MAX_FREE_CHUNK_LEVEL; i++) {
-        freeChunkList.push_back(nullptr);
-    }
-};
+FreeChunkMap::FreeChunkMap(FreeChunkPolicy policy)
+    :numFreePages(0), policy(policy), reusedPages(true /* enable */), appendedPages(true /* enable */),
+      allocationLatencyHistogram{} {}
 
 FreeChunkMap::~FreeChunkMap() {
-    for (int i = 0; i < MAX_FREE_CHUNK_LEVEL; i++) {
-        std::unique_ptr<FreeChunkEntry> curr = std::move(freeChunkList[i]);
-        while (curr != nullptr) {
-            // std::move will set the original variable to nullptr.
-            // automatic garbage collection will deallocate the memory.
-            curr = std::move(curr->nextEntry);
-        }
-    }
-
-    freeChunkList.clear();
-    existingFreeChunks.clear();
-    maxAvailLevel = INVALID_FREE_CHUNK_LEVEL;
+    freeChunksByStart.clear();
+    freeChunksBySize.clear();
+    pendingFreeChunks.clear();
+    numFreePages = 0;
 }
 
-/*
- * This function returns which FREE_CHUNK_LEVEL a given numPages belongs to.
- * For example,
- *     numPages  <  2   -> FREE_CHUNK_LEVEL_0
- *     numPages  <  4   -> FREE_CHUNK_LEVEL_2
- *     numPages  <  8   -> FREE_CHUNK_LEVEL_4
- *     numPages  <  16  -> FREE_CHUNK_LEVEL_8
- *     ...
- * One exception is FREE_CHUNK_LEVEL_128 since it is the top level:
- *     numPages >= 128  -> FREE_CHUNK_LEVEL_128
- */
-FreeChunkLevel FreeChunkMap::getChunkLevel(const page_idx_t numPages)
+/* Register an extent in both indexes. The caller guarantees it does not overlap any other extent */
+void FreeChunkMap::insertEntry(const page_idx_t pageIdx, const page_idx_t numPages)
 {
-    /* if numPage <= ith FreeChunkLevelPageNumLimit, we put it at FREE_CHUNK_LEVEL_i */
-    for (int i = FREE_CHUNK_LEVEL_0; i < MAX_FREE_CHUNK_LEVEL; i++) {
-        if (numPages < FreeChunkLevelPageNumLimit[i]) {
-            return static_cast<FreeChunkLevel>(i);
-        }
-    }
+    KU_ASSERT(numPages != 0);
+    freeChunksByStart.emplace(pageIdx, numPages);
+    freeChunksBySize.emplace(numPages, pageIdx);
+    numFreePages += numPages;
+}
 
-    /* You should never reach here since FreeChunkLevelPageNumLimit has last entry as UINT32_MAX */
-    KU_ASSERT(false);
-    return MAX_FREE_CHUNK_LEVEL;
+/* Remove an extent from both indexes */
+void FreeChunkMap::removeEntry(const page_idx_t pageIdx, const page_idx_t numPages)
+{
+    KU_ASSERT(freeChunksByStart.contains(pageIdx) && freeChunksByStart.at(pageIdx) == numPages);
+    freeChunksByStart.erase(pageIdx);
+    freeChunksBySize.erase(std::make_pair(numPages, pageIdx));
+    KU_ASSERT(numFreePages >= numPages);
+    numFreePages -= numPages;
 }
 
- /* Update maxAvailLevel by checking the nullness of freeChunkList entry backwards */
-void FreeChunkMap::updateMaxAvailLevel()
+/* Find the extent with the lowest start page that has at least numPages pages */
+std::map<page_idx_t, page_idx_t>::const_iterator FreeChunkMap::findFirstFit(
+    const page_idx_t numPages, const page_idx_t maxPageIdx) const
 {
-    FreeChunkLevel nextAvailLevel = INVALID_FREE_CHUNK_LEVEL;
-    for (int i = maxAvailLevel; i >= FREE_CHUNK_LEVEL_0; i--) {
-        if (freeChunkList[i] != nullptr) {
-            nextAvailLevel = static_cast<FreeChunkLevel>(i);
-            break;
+    for (auto it = freeChunksByStart.begin();
+         it != freeChunksByStart.end() && it->first < maxPageIdx; it++) {
+        if (it->second >= numPages) {
+            return it;
         }
     }
-    maxAvailLevel = nextAvailLevel;
+    return freeChunksByStart.end();
 }
 
 /*
- * Try to retrieve an satisfying entry from FreeChunkMap based on required numPages
- * Note: Any caller of this function need to add the entry back to FreeChunkMap after use so that the rest
- *       of its unused space will be reused
+ * Find the smallest extent that has at least numPages pages. Ties are broken by the lowest start page
+ * to keep data near the beginning of the file.
  */
-std::unique_ptr<FreeChunkEntry> FreeChunkMap::getFreeChunk(const page_idx_t numPages)
+std::set<std::pair<page_idx_t, page_idx_t>>::const_iterator FreeChunkMap::findBestFit(
+    const page_idx_t numPages, const page_idx_t maxPageIdx) const
 {
-    /* 0. return immediately if we disabled FreeChunkMap or it does not want any pages */
-    if (!ENABLE_FREE_CHUNK_MAP || numPages == 0) {
-        return nullptr;
+    auto it = freeChunksBySize.lower_bound(std::make_pair(numPages, page_idx_t{0}));
+    while (it != freeChunksBySize.end() && it->second >= maxPageIdx) {
+        it++;
     }
+    return it;
+}
 
-    /* 1. Get the corresponding ChunkLevel numPages belongs to */
-    FreeChunkLevel curLevel = getChunkLevel(numPages);
-    KU_ASSERT(curLevel < MAX_FREE_CHUNK_LEVEL);
+void FreeChunkMap::recordAllocationLatency(const uint64_t latencyInNs)
+{
+    const auto bucketIdx = std::min<size_t>(std::bit_width(latencyInNs),
+        NUM_ALLOCATION_LATENCY_BUCKETS - 1);
+    allocationLatencyHistogram[bucketIdx]++;
+}
 
-    /* 2. return nullptr if we have no entry for the given level and above */
-    if (maxAvailLevel < curLevel) {
+/*
+ * Retrieve numPages consecutive free pages from FreeChunkMap based on the policy of the database.
+ * The unused tail of the chosen extent is kept in FreeChunkMap.
+ */
+std::unique_ptr<FreeChunkEntry> FreeChunkMap::getFreeChunk(const page_idx_t numPages,
+    const page_idx_t maxPageIdx)
+{
+    std::lock_guard lck{mtx};
+    /* 0. Check if we are allowed to reuse pages at all */
+    if (policy == FreeChunkPolicy::APPEND_ONLY || numPages == 0) {
         return nullptr;
     }
+    const auto startTime = std::chrono::steady_clock::now();
 
-    /* 3. Now, search a usable entry for given numPages and timestamp until exceeding the max level */
-    while (curLevel <= maxAvailLevel) {
-        /* if the level we are searching has no space to reuse, continue search the next level */
-        if (freeChunkList[curLevel] == nullptr) {
-            curLevel = static_cast<FreeChunkLevel>((curLevel + 1 < maxAvailLevel)? curLevel + 1:maxAvailLevel);
-            continue;
+    /* 1. Find an extent whose size >= numPages (and which starts before maxPageIdx) */
+    page_idx_t extentPageIdx = INVALID_PAGE_IDX;
+    page_idx_t extentNumPages = 0;
+    if (policy == FreeChunkPolicy::FIRST_FIT) {
+        const auto it = findFirstFit(numPages, maxPageIdx);
+        if (it != freeChunksByStart.end()) {
+            extentPageIdx = it->first;
+            extentNumPages = it->second;
         }
-
-        /* Search the current level for an entry with valid reuse timestamp */
-        KU_ASSERT(freeChunkList[curLevel] != nullptr);
-        /* curEntry and lastSearchEntry are raw pointers to traverse the linked list */
-        FreeChunkEntry* curEntry = freeChunkList[curLevel].get();
-        FreeChunkEntry *lastSearchEntry = nullptr;
-        /* entryToReturn is the unique pointer instance to return from the function */
-        std::unique_ptr<FreeChunkEntry> entryToReturn = nullptr;
-        while (curEntry != nullptr) {
-            if (curEntry->numPages >= numPages) {
-                /* found a valid entry to reuse. Remove it from current linked list */
-                if (lastSearchEntry == nullptr) {
-                    /* the valid entry is the first entry in the L.L. */
-                    entryToReturn = std::move(freeChunkList[curLevel]);
-                    freeChunkList[curLevel] = std::move(entryToReturn->nextEntry);
-
-                    /* update maxAvailLevel if we have removed the last entry of the max available Level */
-                    if (curLevel == maxAvailLevel && freeChunkList[curLevel] == nullptr) {
-                        updateMaxAvailLevel();
-                    }
-                } else {
-                    /* need to unlink it from its parent */
-                    entryToReturn = std::move(lastSearchEntry->nextEntry);
-                    lastSearchEntry->nextEntry = std::move(entryToReturn->nextEntry);
-                }
-
-		/* Return it to caller */
-                entryToReturn->nextEntry = nullptr;
-                existingFreeChunks.erase(entryToReturn->pageIdx);
-                return entryToReturn;
-            }
-
-            /* Move to the next entry */
-            lastSearchEntry = curEntry;
-            curEntry = curEntry->nextEntry.get();
+    } else {
+        const auto it = findBestFit(numPages, maxPageIdx);
+        if (it != freeChunksBySize.end()) {
+            extentPageIdx = it->second;
+            extentNumPages = it->first;
         }
+    }
 
-        /* We found no suitable entry in this level. Move to the next level */
-        curLevel = static_cast<FreeChunkLevel>(curLevel + 1);
+    /* 2. Take the head of the extent and put the remaining pages back */
+    std::unique_ptr<FreeChunkEntry> entry;
+    if (extentPageIdx != INVALID_PAGE_IDX) {
+        removeEntry(extentPageIdx, extentNumPages);
+        if (extentNumPages > numPages) {
+            insertEntry(extentPageIdx + numPages, extentNumPages - numPages);
+        }
+        entry = std::make_unique<FreeChunkEntry>();
+        entry->pageIdx = extentPageIdx;
+        entry->numPages = numPages;
+        reusedPages.increase(numPages);
     }
-    
-    /* No reusable chunk. Just return nullptr here */
-    return nullptr;
+    /* No reusable chunk found still counts as an allocation attempt */
+    recordAllocationLatency(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - startTime).count());
+    return entry;
 }
 
-/* Add entry to FreeChunkMap given the physical info of a recycled chunk */
+/*
+ * Add entry to FreeChunkMap given the physical info of a recycled chunk. The chunk is kept aside until
+ * the current checkpoint completes, see releasePendingFreeChunks.
+ */
 void FreeChunkMap::addFreeChunk(const page_idx_t pageIdx, const page_idx_t numPages)
 {
+    std::lock_guard lck{mtx};
     KU_ASSERT(pageIdx != INVALID_PAGE_IDX && numPages != 0);
-    /* 0. Check if we enabled FreeChunkMap feature */
-    if (!ENABLE_FREE_CHUNK_MAP) {
-        return;
+    pendingFreeChunks.push_back(FreeChunkEntry{pageIdx, numPages});
+}
+
+void FreeChunkMap::recordAppendedPages(const page_idx_t numPages)
+{
+    std::lock_guard lck{mtx};
+    appendedPages.increase(numPages);
+}
+
+void FreeChunkMap::releasePendingFreeChunks()
+{
+    std::lock_guard lck{mtx};
+    for (const auto& entry : pendingFreeChunks) {
+        insertFreeChunk(entry.pageIdx, entry.numPages);
+    }
+    pendingFreeChunks.clear();
+}
+
+/*
+ * Insert a free extent. If it touches a free extent on either side, they are merged into a single
+ * extent so that later large allocations can reuse the space.
+ */
+void FreeChunkMap::insertFreeChunk(const page_idx_t pageIdx, const page_idx_t numPages)
+{
+    page_idx_t newPageIdx = pageIdx;
+    page_idx_t newNumPages = numPages;
+
+    /* 1. Coalesce with the extent right after the recycled chunk */
+    const auto next = freeChunksByStart.lower_bound(pageIdx);
+    if (next != freeChunksByStart.end()) {
+        /* Make sure we never register the same page twice */
+        if (next->first < pageIdx + numPages) {
+            KU_ASSERT(false);
+            return;
+        }
+        if (next->first == pageIdx + numPages) {
+            newNumPages += next->second;
+            removeEntry(next->first, next->second);
+        }
     }
 
-    /* 1. Make sure we do not have duplicate entry here */
-    if (existingFreeChunks.contains(pageIdx)) {
-        KU_ASSERT(0);
-        return;
+    /* 2. Coalesce with the extent right before the recycled chunk */
+    const auto prevNext = freeChunksByStart.lower_bound(pageIdx);
+    if (prevNext != freeChunksByStart.begin()) {
+        const auto prev = std::prev(prevNext);
+        if (prev->first + prev->second > pageIdx) {
+            KU_ASSERT(false);
+            return;
+        }
+        if (prev->first + prev->second == pageIdx) {
+            newPageIdx = prev->first;
+            newNumPages += prev->second;
+            removeEntry(prev->first, prev->second);
+        }
     }
 
-    /* 2. Get the corresponding ChunkLevel numPages belongs to */
-    const FreeChunkLevel curLevel = getChunkLevel(numPages);
-    KU_ASSERT(curLevel < MAX_FREE_CHUNK_LEVEL);
+    /* 3. Insert the (possibly merged) extent */
+    insertEntry(newPageIdx, newNumPages);
+}
 
-    /* 3. Create a new FreeChunkEntry */
-    auto entry = std::make_unique<FreeChunkEntry>();
-    entry->pageIdx = pageIdx;
-    entry->numPages = numPages;
+page_idx_t FreeChunkMap::removeTailFreeChunk(const page_idx_t numPagesInFile)
+{
+    std::lock_guard lck{mtx};
+    if (freeChunksByStart.empty()) {
+        return numPagesInFile;
+    }
+    const auto [pageIdx, numPages] = *freeChunksByStart.rbegin();
+    if (pageIdx + numPages != numPagesInFile) {
+        return numPagesInFile;
+    }
+    removeEntry(pageIdx, numPages);
+    return pageIdx;
+}
 
-    /* 4. Insert it into the L.L. */
-    if (freeChunkList[curLevel] == nullptr) {
-        freeChunkList[curLevel] = std::move(entry);
-        if (maxAvailLevel < curLevel) {
-            maxAvailLevel = curLevel;
+void FreeChunkMap::removeFreeChunksBeyond(const page_idx_t numPagesInFile)
+{
+    std::lock_guard lck{mtx};
+    while (!freeChunksByStart.empty()) {
+        const auto [pageIdx, numPages] = *freeChunksByStart.rbegin();
+        if (pageIdx + numPages <= numPagesInFile) {
+            break;
         }
-    } else {
-        /* Traverse to last node in list */
-        FreeChunkEntry *curEntryInList = freeChunkList[curLevel].get();
-        while (curEntryInList->nextEntry != nullptr) {
-            curEntryInList = curEntryInList->nextEntry.get();
+        removeEntry(pageIdx, numPages);
+        if (pageIdx < numPagesInFile) {
+            insertEntry(pageIdx, numPagesInFile - pageIdx);
         }
+    }
+}
+
+FreeChunkMapStats FreeChunkMap::getStats() const
+{
+    std::lock_guard lck{mtx};
+    FreeChunkMapStats stats;
+    stats.policy = policy;
+    stats.numFreeChunks = freeChunksByStart.size();
+    stats.numFreePages = numFreePages;
+    stats.largestFreeChunk = freeChunksBySize.empty() ? 0 : freeChunksBySize.rbegin()->first;
+    stats.numReusedPages = reusedPages.accumulatedValue;
+    stats.numAppendedPages = appendedPages.accumulatedValue;
+    stats.allocationLatencyHistogram = allocationLatencyHistogram;
+    stats.fragmentation = numFreePages == 0 ?
+                              0 :
+                              1.0 - static_cast<double>(stats.largestFreeChunk) /
+                                        static_cast<double>(numFreePages);
+    return stats;
+}
+
+std::vector<FreeChunkEntry> FreeChunkMap::getFreeChunks() const
+{
+    std::lock_guard lck{mtx};
+    return getFreeChunksNoLock();
+}
 
-        KU_ASSERT(curEntryInList != nullptr);
-        curEntryInList->nextEntry = std::move(entry);
+std::vector<FreeChunkEntry> FreeChunkMap::getFreeChunksNoLock() const
+{
+    std::vector<FreeChunkEntry> entries;
+    entries.reserve(freeChunksByStart.size());
+    for (const auto& [pageIdx, numPages] : freeChunksByStart) {
+        entries.push_back(FreeChunkEntry{pageIdx, numPages});
     }
-    existingFreeChunks.insert(pageIdx);
+    return entries;
 }
 
 /*
@@ -194,56 +263,35 @@ void FreeChunkMap::addFreeChunk(const page_idx_t pageIdx, const page_idx_t numPa
  * free chunk map.
  */
 void FreeChunkEntry::serialize(Serializer& serializer) const {
-    if (!ENABLE_FREE_CHUNK_MAP) {
-        return;
-    }
-    serializer.writeDebuggingInfo("pageIdx");
     serializer.write<page_idx_t>(pageIdx);
-    serializer.writeDebuggingInfo("numPages");
     serializer.write<page_idx_t>(numPages);
-    serializer.writeDebuggingInfo("nextEntry");
-    serializer.serializeOptionalValue<FreeChunkEntry>(nextEntry);
 }
 
 /*
  * Deserializes free chunk entry when restoring from checkpoint
  */
-std::unique_ptr<FreeChunkEntry> FreeChunkEntry::deserialize(Deserializer& deserializer) {
-    if (!ENABLE_FREE_CHUNK_MAP) {
-        return nullptr;
-    }
-    std::string str;
-    page_idx_t pageIdx = INVALID_PAGE_IDX;
-    page_idx_t numPages = INVALID_PAGE_IDX;
-    std::unique_ptr<FreeChunkEntry> nextEntry = nullptr;
-    deserializer.validateDebuggingInfo(str, "pageIdx");
-    deserializer.deserializeValue<page_idx_t>(pageIdx);
-    deserializer.validateDebuggingInfo(str, "numPages");
-    deserializer.deserializeValue<page_idx_t>(numPages);
-    deserializer.validateDebuggingInfo(str, "nextEntry");
-    deserializer.deserializeOptionalValue(nextEntry);
-    auto currentEntry = std::make_unique<FreeChunkEntry>();
-    currentEntry->pageIdx = std::move(pageIdx);
-    currentEntry->numPages = std::move(numPages);
-    currentEntry->nextEntry = std::move(nextEntry);
-    return currentEntry;
+FreeChunkEntry FreeChunkEntry::deserialize(Deserializer& deserializer) {
+    FreeChunkEntry entry;
+    deserializer.deserializeValue<page_idx_t>(entry.pageIdx);
+    deserializer.deserializeValue<page_idx_t>(entry.numPages);
+    return entry;
 }
 
 
 /*
- * Serializes free chunk map for persistence.
+ * Serializes free chunk map for persistence. The policy is written first, followed by the extents
+ * ordered by start page; the size index is rebuilt on load. Pending chunks are written as free ones
+ * since they are no longer referenced by the metadata written in the same checkpoint.
  */
 void FreeChunkMap::serialize(Serializer& serializer) const
 {
-    if (!ENABLE_FREE_CHUNK_MAP) {
-        return;
-    }
-    serializer.writeDebuggingInfo("maxAvailLevel");
-    serializer.write<FreeChunkLevel>(maxAvailLevel);
-    serializer.writeDebuggingInfo("freeChunkList");
-    serializer.serializeVectorOfNullablePtrs<FreeChunkEntry>(freeChunkList);
-    serializer.writeDebuggingInfo("existingFreeChunks");
-    serializer.serializeUnorderedSet<page_idx_t>(existingFreeChunks);
+    std::lock_guard lck{mtx};
+    serializer.writeDebuggingInfo("policy");
+    serializer.write<FreeChunkPolicy>(policy);
+    auto freeChunks = getFreeChunksNoLock();
+    freeChunks.insert(freeChunks.end(), pendingFreeChunks.begin(), pendingFreeChunks.end());
+    serializer.writeDebuggingInfo("freeChunks");
+    serializer.serializeVector<FreeChunkEntry>(freeChunks);
 }
 
 /*
@@ -251,22 +299,22 @@ void FreeChunkMap::serialize(Serializer& serializer) const
  */
 void FreeChunkMap::deserialize(Deserializer& deserializer)
 {
-    if (!ENABLE_FREE_CHUNK_MAP) {
-        return;
-    }
     std::string str;
-    std::vector<std::unique_ptr<FreeChunkEntry>> freeChunkList;
-    std::unordered_set<page_idx_t> existingFreeChunks;
-    FreeChunkLevel maxAvailLevel = INVALID_FREE_CHUNK_LEVEL;
-    deserializer.validateDebuggingInfo(str, "maxAvailLevel");
-    deserializer.deserializeValue<FreeChunkLevel>(maxAvailLevel);
-    deserializer.validateDebuggingInfo(str, "freeChunkList");
-    deserializer.deserializeVectorOfNullablePtrs<FreeChunkEntry>(freeChunkList);
-    deserializer.validateDebuggingInfo(str, "existingFreeChunks");
-    deserializer.deserializeUnorderedSet<page_idx_t>(existingFreeChunks);
-    this->maxAvailLevel = std::move(maxAvailLevel);
-    this->freeChunkList = std::move(freeChunkList);
-    this->existingFreeChunks = std::move(existingFreeChunks);
+    std::vector<FreeChunkEntry> freeChunks;
+    FreeChunkPolicy persistedPolicy;
+    deserializer.validateDebuggingInfo(str, "policy");
+    deserializer.deserializeValue<FreeChunkPolicy>(persistedPolicy);
+    deserializer.validateDebuggingInfo(str, "freeChunks");
+    deserializer.deserializeVector<FreeChunkEntry>(freeChunks);
+    std::lock_guard lck{mtx};
+    policy = persistedPolicy;
+    freeChunksByStart.clear();
+    freeChunksBySize.clear();
+    pendingFreeChunks.clear();
+    numFreePages = 0;
+    for (const auto& entry : freeChunks) {
+        insertFreeChunk(entry.pageIdx, entry.numPages);
+    }
 }
 
 } // namespace storage
@@ -442,6 +442,17 @@ std::vector<struct std::pair<page_idx_t, page_idx_t>> ListChunkData::getAllChunk
     return chunkInfo;
 }
 
+void ListChunkData::collectOnDiskChunks(std::vector<ColumnChunkData*>& chunks)
+{
+    if (getResidencyState() != ResidencyState::ON_DISK) {
+        return;
+    }
+    ColumnChunkData::collectOnDiskChunks(chunks);
+    offsetColumnChunk->collectOnDiskChunks(chunks);
+    sizeColumnChunk->collectOnDiskChunks(chunks);
+    dataColumnChunk->collectOnDiskChunks(chunks);
+}
+
 void ListChunkData::serialize(Serializer& serializer) const {
     ColumnChunkData::serialize(serializer);
     serializer.writeDebuggingInfo("size_column_chunk");
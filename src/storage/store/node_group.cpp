@@ -106,6 +106,19 @@ void NodeGroup::initializeScanState(Transaction* transaction, TableScanState& st
     initializeScanState(transaction, lock, state);
 }
 
+// Hints the buffer manager not to keep the pages of the chunk cached. The pages are prefetched
+// lazily as the scan advances, see ChunkedNodeGroup::scan.
+static void initSequentialChunkScan(ChunkState& state) {
+    state.pageAccessHint = PageAccessHint::STREAMING;
+    state.numPrefetchedPages = 0;
+    if (state.nullState) {
+        initSequentialChunkScan(*state.nullState);
+    }
+    for (auto& childState : state.childrenStates) {
+        initSequentialChunkScan(childState);
+    }
+}
+
 void NodeGroup::initializeScanState(Transaction*, const UniqLock& lock, TableScanState& state) {
     auto& nodeGroupScanState = *state.nodeGroupScanState;
     nodeGroupScanState.chunkedGroupIdx = 0;
@@ -122,6 +135,11 @@ void NodeGroup::initializeScanState(Transaction*, const UniqLock& lock, TableSca
             }
             auto& chunk = firstChunkedGroup->getColumnChunk(columnID);
             chunk.initializeScanState(nodeGroupScanState.chunkStates[i], state.columns[i]);
+            // Most rows are skipped if a semi mask is applied, so only full scans are sequential.
+            if (state.sequentialScan &&
+                (state.semiMask == nullptr || !state.semiMask->isEnabled())) {
+                initSequentialChunkScan(nodeGroupScanState.chunkStates[i]);
+            }
         }
     }
 }
@@ -130,36 +148,47 @@ NodeGroupScanResult NodeGroup::scan(Transaction* transaction, TableScanState& st
     // TODO(Guodong): Move the locked part of figuring out the chunked group to initScan.
     const auto lock = chunkedGroups.lock();
     auto& nodeGroupScanState = *state.nodeGroupScanState;
-    KU_ASSERT(nodeGroupScanState.chunkedGroupIdx < chunkedGroups.getNumGroups(lock));
-    const auto chunkedGroup = chunkedGroups.getGroup(lock, nodeGroupScanState.chunkedGroupIdx);
-    if (chunkedGroup && nodeGroupScanState.numScannedRows >=
-                            chunkedGroup->getNumRows() + chunkedGroup->getStartRowIdx()) {
-        nodeGroupScanState.chunkedGroupIdx++;
-    }
-    if (nodeGroupScanState.chunkedGroupIdx >= chunkedGroups.getNumGroups(lock)) {
-        return NODE_GROUP_SCAN_EMMPTY_RESULT;
-    }
-    const auto& chunkedGroupToScan =
-        *chunkedGroups.getGroup(lock, nodeGroupScanState.chunkedGroupIdx);
-    const auto rowIdxInChunkToScan =
-        nodeGroupScanState.numScannedRows - chunkedGroupToScan.getStartRowIdx();
-    const auto numRowsToScan =
-        std::min(chunkedGroupToScan.getNumRows() - rowIdxInChunkToScan, DEFAULT_VECTOR_CAPACITY);
-    if (state.source == TableScanSource::COMMITTED && state.semiMask &&
-        state.semiMask->isEnabled()) {
-        const auto startNodeOffset = nodeGroupScanState.numScannedRows +
-                                     StorageUtils::getStartOffsetOfNodeGroup(state.nodeGroupIdx);
-        if (!state.semiMask->isAnyMasked(startNodeOffset, startNodeOffset + numRowsToScan - 1)) {
-            state.outState->getSelVectorUnsafe().setSelSize(0);
+    while (true) {
+        KU_ASSERT(nodeGroupScanState.chunkedGroupIdx < chunkedGroups.getNumGroups(lock));
+        const auto chunkedGroup = chunkedGroups.getGroup(lock, nodeGroupScanState.chunkedGroupIdx);
+        if (chunkedGroup && nodeGroupScanState.numScannedRows >=
+                                chunkedGroup->getNumRows() + chunkedGroup->getStartRowIdx()) {
+            nodeGroupScanState.chunkedGroupIdx++;
+        }
+        if (nodeGroupScanState.chunkedGroupIdx >= chunkedGroups.getNumGroups(lock)) {
+            return NODE_GROUP_SCAN_EMMPTY_RESULT;
+        }
+        const auto& chunkedGroupToScan =
+            *chunkedGroups.getGroup(lock, nodeGroupScanState.chunkedGroupIdx);
+        const auto rowIdxInChunkToScan =
+            nodeGroupScanState.numScannedRows - chunkedGroupToScan.getStartRowIdx();
+        const auto numRowsToScan = std::min(chunkedGroupToScan.getNumRows() - rowIdxInChunkToScan,
+            DEFAULT_VECTOR_CAPACITY);
+        // Vectors whose rows are all deleted, which are common in node groups that were rewritten
+        // after heavy deletions, are stepped over without checking zone maps or reading pages.
+        if (chunkedGroupToScan.getNumDeletions(transaction, rowIdxInChunkToScan, numRowsToScan) ==
+            numRowsToScan) {
             nodeGroupScanState.numScannedRows += numRowsToScan;
-            return NodeGroupScanResult{nodeGroupScanState.numScannedRows, 0};
+            continue;
         }
+        if (state.source == TableScanSource::COMMITTED && state.semiMask &&
+            state.semiMask->isEnabled()) {
+            const auto startNodeOffset =
+                nodeGroupScanState.numScannedRows +
+                StorageUtils::getStartOffsetOfNodeGroup(state.nodeGroupIdx);
+            if (!state.semiMask->isAnyMasked(startNodeOffset,
+                    startNodeOffset + numRowsToScan - 1)) {
+                state.outState->getSelVectorUnsafe().setSelSize(0);
+                nodeGroupScanState.numScannedRows += numRowsToScan;
+                return NodeGroupScanResult{nodeGroupScanState.numScannedRows, 0};
+            }
+        }
+        chunkedGroupToScan.scan(transaction, state, nodeGroupScanState, rowIdxInChunkToScan,
+            numRowsToScan);
+        const auto startRow = nodeGroupScanState.numScannedRows;
+        nodeGroupScanState.numScannedRows += numRowsToScan;
+        return NodeGroupScanResult{startRow, numRowsToScan};
     }
-    chunkedGroupToScan.scan(transaction, state, nodeGroupScanState, rowIdxInChunkToScan,
-        numRowsToScan);
-    const auto startRow = nodeGroupScanState.numScannedRows;
-    nodeGroupScanState.numScannedRows += numRowsToScan;
-    return NodeGroupScanResult{startRow, numRowsToScan};
 }
 
 bool NodeGroup::lookup(const UniqLock& lock, Transaction* transaction,
@@ -251,6 +280,20 @@ std::vector<std::pair<page_idx_t, page_idx_t>> NodeGroup::getAllChunkPhysicInfo(
     return chunkInfo;
 }
 
+void NodeGroup::collectOnDiskChunks(const std::vector<column_id_t>& columnIDs,
+    std::vector<ColumnChunkData*>& chunks)
+{
+    const auto lock = chunkedGroups.lock();
+    for (auto& chunkedGroup : chunkedGroups.getAllGroups(lock)) {
+        if (chunkedGroup->getResidencyState() != ResidencyState::ON_DISK) {
+            continue;
+        }
+        for (const auto columnID : columnIDs) {
+            chunkedGroup->getColumnChunk(columnID).getData().collectOnDiskChunks(chunks);
+        }
+    }
+}
+
 void NodeGroup::addChunkDataForColumn(common::column_id_t columnID, ChunkedNodeGroup &chunkedGroup,
     std::vector<std::pair<page_idx_t, page_idx_t>> &chunkInfo)
 {
@@ -294,8 +337,16 @@ void NodeGroup::checkpoint(MemoryManager& memoryManager, NodeGroupCheckpointStat
     isAllDeleted = (checkpointedVersionInfo->getNumDeletions(&DUMMY_CHECKPOINT_TRANSACTION, 0, DEFAULT_VECTOR_CAPACITY) == getNumRows());
     if (!isAllDeleted) {
         std::unique_ptr<ChunkedNodeGroup> checkpointedChunkedGroup;
+        const auto numDeletions =
+            checkpointedVersionInfo->getNumDeletions(&DUMMY_CHECKPOINT_TRANSACTION, 0, getNumRows());
+        const auto needsDenseRewrite = state.rewriteThreshold < 1.0 && numDeletions > 0 &&
+                                       static_cast<double>(numDeletions) >=
+                                           state.rewriteThreshold * static_cast<double>(getNumRows());
         /* if given chunk group has non-deleted data, flush it to disk here */
-        if (hasPersistentData) {
+        if (hasPersistentData && needsDenseRewrite) {
+            checkpointedChunkedGroup =
+                checkpointDenseRewrite(memoryManager, lock, state, *checkpointedVersionInfo);
+        } else if (hasPersistentData) {
             checkpointedChunkedGroup = checkpointInMemAndOnDisk(memoryManager, lock, state);
         } else {
             checkpointedChunkedGroup = checkpointInMemOnly(memoryManager, lock, state);
@@ -383,6 +434,71 @@ std::unique_ptr<ChunkedNodeGroup> NodeGroup::checkpointInMemAndOnDisk(MemoryMana
     return checkpointedChunkedGroup;
 }
 
+static void setDeletedRowsToNull(ChunkedNodeGroup& chunkedGroup, row_idx_t startRowInGroup,
+    const VersionInfo& versionInfo, idx_t pkColumnIdx) {
+    for (auto row = 0u; row < chunkedGroup.getNumRows(); row++) {
+        if (!versionInfo.isDeleted(&DUMMY_CHECKPOINT_TRANSACTION, startRowInGroup + row)) {
+            continue;
+        }
+        for (auto i = 0u; i < chunkedGroup.getNumColumns(); i++) {
+            if (i == pkColumnIdx) {
+                continue;
+            }
+            if (const auto nullData = chunkedGroup.getColumnChunk(i).getData().getNullData()) {
+                nullData->setNull(row, true);
+            }
+        }
+    }
+}
+
+/*
+ * Rewrite a heavily deleted node group into freshly allocated column chunks. Node offsets are kept as
+ * they are, since both the primary key index and the CSR lists of rel tables refer to them. Instead,
+ * deleted rows are stored as nulls, so that their strings are dropped from the dictionaries and their
+ * values no longer widen the range of the compressed data. Scans skip vectors whose rows are all
+ * deleted, see NodeGroup::scan. The pages of the old chunks are recycled.
+ */
+std::unique_ptr<ChunkedNodeGroup> NodeGroup::checkpointDenseRewrite(MemoryManager& memoryManager,
+    const UniqLock& lock, NodeGroupCheckpointState& state,
+    const VersionInfo& checkpointedVersionInfo) {
+    const auto firstGroup = chunkedGroups.getFirstGroup(lock);
+    KU_ASSERT(firstGroup && firstGroup->getResidencyState() == ResidencyState::ON_DISK);
+    std::vector<Column*> columnPtrs;
+    std::vector<LogicalType> columnTypes;
+    columnPtrs.reserve(state.columns.size());
+    for (auto& column : state.columns) {
+        columnPtrs.push_back(column.get());
+        columnTypes.push_back(column->getDataType().copy());
+    }
+    const auto persistentChunkedGroup = scanAllInsertedAndVersions<ResidencyState::ON_DISK>(
+        memoryManager, lock, state.columnIDs, columnPtrs);
+    const auto insertChunkedGroup = scanAllInsertedAndVersions<ResidencyState::IN_MEMORY>(
+        memoryManager, lock, state.columnIDs, columnPtrs);
+    const auto numPersistentRows = persistentChunkedGroup->getNumRows();
+    const auto numInsertedRows = insertChunkedGroup->getNumRows();
+    setDeletedRowsToNull(*persistentChunkedGroup, 0, checkpointedVersionInfo, state.pkColumnIdx);
+    setDeletedRowsToNull(*insertChunkedGroup, numPersistentRows, checkpointedVersionInfo,
+        state.pkColumnIdx);
+    // Appending into new chunks rebuilds string dictionaries without the values of deleted rows.
+    auto denseChunkedGroup = std::make_unique<ChunkedNodeGroup>(memoryManager, columnTypes,
+        enableCompression, numPersistentRows + numInsertedRows, 0, ResidencyState::IN_MEMORY);
+    denseChunkedGroup->append(&DUMMY_CHECKPOINT_TRANSACTION, *persistentChunkedGroup, 0,
+        numPersistentRows);
+    denseChunkedGroup->append(&DUMMY_CHECKPOINT_TRANSACTION, *insertChunkedGroup, 0,
+        numInsertedRows);
+    // Old chunks stay readable until this checkpoint is durable, see FreeChunkMap::addFreeChunk.
+    std::vector<ColumnChunkData*> oldChunks;
+    for (const auto columnID : state.columnIDs) {
+        firstGroup->getColumnChunk(columnID).getData().collectOnDiskChunks(oldChunks);
+    }
+    auto& freeChunkMap = state.dataFH.getFreeChunkMap();
+    for (const auto chunk : oldChunks) {
+        freeChunkMap.addFreeChunk(chunk->getMetadata().pageIdx, chunk->getMetadata().numPages);
+    }
+    denseChunkedGroup->flush(state.dataFH);
+    return denseChunkedGroup;
+}
+
 std::unique_ptr<ChunkedNodeGroup> NodeGroup::checkpointInMemOnly(MemoryManager& memoryManager,
     const UniqLock& lock, NodeGroupCheckpointState& state) {
     // Flush insertChunkedGroup to persistent one.
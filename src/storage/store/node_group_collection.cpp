@@ -1,6 +1,9 @@
 #include "storage/store/node_group_collection.h"
 
+#include "common/task_system/task_scheduler.h"
 #include "common/vector/value_vector.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/store/csr_node_group.h"
 #include "storage/store/table.h"
@@ -206,6 +209,15 @@ std::vector<std::pair<page_idx_t, page_idx_t>> NodeGroupCollection::getAllChunkP
     return allChunkPhysicInfo;
 }
 
+void NodeGroupCollection::collectOnDiskChunks(const std::vector<column_id_t>& columnIDs,
+    std::vector<ColumnChunkData*>& chunks)
+{
+    const auto lock = nodeGroups.lock();
+    for (const auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
+        nodeGroup->collectOnDiskChunks(columnIDs, chunks);
+    }
+}
+
 uint64_t NodeGroupCollection::getEstimatedMemoryUsage() {
     auto estimatedMemUsage = 0u;
     const auto lock = nodeGroups.lock();
@@ -219,15 +231,72 @@ void NodeGroupCollection::checkpoint(MemoryManager& memoryManager,
     NodeGroupCheckpointState& state) {
     KU_ASSERT(dataFH);
     const auto lock = nodeGroups.lock();
-    for (idx_t i = 0; i < nodeGroups.getNumGroups(lock);) {
-        const auto& nodeGroup = nodeGroups.getGroup(lock, i);
+    for (const auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
         nodeGroup->checkpoint(memoryManager, state);
-        if (nodeGroup->isAllRowDeleted()) {
-            /* remove this node group if it is all deleted */
-            auto groupPtr = nodeGroups.removeGroup(lock, i);
+    }
+    removeAllDeletedGroups(lock);
+}
+
+namespace {
+
+// Each worker thread repeatedly picks the next node group that has not been checkpointed yet.
+class NodeGroupCheckpointTask final : public Task {
+public:
+    NodeGroupCheckpointTask(uint64_t maxNumThreads, MemoryManager& memoryManager,
+        NodeGroupCheckpointState& state, std::vector<NodeGroup*> nodeGroups)
+        : Task{maxNumThreads}, memoryManager{memoryManager}, state{state},
+          nodeGroups{std::move(nodeGroups)}, nextNodeGroupIdx{0} {}
+
+    void run() override {
+        while (true) {
+            const auto nodeGroupIdx = nextNodeGroupIdx.fetch_add(1);
+            if (nodeGroupIdx >= nodeGroups.size()) {
+                break;
+            }
+            nodeGroups[nodeGroupIdx]->checkpoint(memoryManager, state);
+        }
+    }
+
+private:
+    MemoryManager& memoryManager;
+    NodeGroupCheckpointState& state;
+    std::vector<NodeGroup*> nodeGroups;
+    std::atomic<idx_t> nextNodeGroupIdx;
+};
+
+} // namespace
+
+void NodeGroupCollection::checkpointInParallel(main::ClientContext& context,
+    MemoryManager& memoryManager, NodeGroupCheckpointState& state) {
+    KU_ASSERT(dataFH);
+    const auto lock = nodeGroups.lock();
+    std::vector<NodeGroup*> groupsToCheckpoint;
+    for (const auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
+        groupsToCheckpoint.push_back(nodeGroup.get());
+    }
+    const auto numThreads =
+        std::min<uint64_t>(context.getClientConfig()->numThreads, groupsToCheckpoint.size());
+    const auto task = std::make_shared<NodeGroupCheckpointTask>(numThreads, memoryManager, state,
+        std::move(groupsToCheckpoint));
+    if (numThreads <= 1) {
+        task->run();
+    } else {
+        // CHECKPOINT itself may run on a worker thread of the scheduler, so a new worker thread is
+        // launched to guarantee progress.
+        processor::ExecutionContext executionContext{nullptr /* profiler */, &context,
+            0 /* queryID */};
+        context.getTaskScheduler()->scheduleTaskAndWaitOrError(task, &executionContext,
+            true /* launchNewWorkerThread */);
+    }
+    removeAllDeletedGroups(lock);
+}
 
+void NodeGroupCollection::removeAllDeletedGroups(const UniqLock& lock) {
+    for (idx_t i = 0; i < nodeGroups.getNumGroups(lock);) {
+        if (nodeGroups.getGroup(lock, i)->isAllRowDeleted()) {
+            /* remove this node group if it is all deleted */
+            nodeGroups.removeGroup(lock, i);
             /* since we removed one entry, just keep the index unchanged here */
-            KU_ASSERT(i <= nodeGroups.getNumGroups(lock));
         } else {
             /* move to next NodeGroup */
             i++;
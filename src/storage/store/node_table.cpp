@@ -1,5 +1,7 @@
 #include "storage/store/node_table.h"
 
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/index_catalog_entry.h"
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
 #include "common/cast.h"
 #include "common/exception/message.h"
@@ -61,6 +63,17 @@ NodeTable::NodeTable(const StorageManager* storageManager,
         getNodeTableColumnTypes(*this), enableCompression, storageManager->getDataFH(), deSer);
     initializePKIndex(storageManager->getDatabasePath(), nodeTableEntry,
         storageManager->isReadOnly(), vfs, context);
+    if (deSer) {
+        std::string key;
+        uint64_t numSecondaryIndexes = 0;
+        deSer->validateDebuggingInfo(key, "num_secondary_indexes");
+        deSer->deserializeValue<uint64_t>(numSecondaryIndexes);
+        for (auto i = 0u; i < numSecondaryIndexes; i++) {
+            auto index = SecondaryIndex::deserialize(*deSer, *dataFH, shadowFile);
+            index->setColumnID(nodeTableEntry->getColumnID(index->getPropertyName()));
+            secondaryIndexes.push_back(std::move(index));
+        }
+    }
 }
 
 std::unique_ptr<NodeTable> NodeTable::loadTable(Deserializer& deSer, const Catalog& catalog,
@@ -222,6 +235,18 @@ void NodeTable::update(Transaction* transaction, TableUpdateState& updateState)
         nodeGroups->getNodeGroup(nodeGroupIdx)
             ->update(transaction, rowIdxInGroup, nodeUpdateState.columnID,
                 nodeUpdateState.propertyVector);
+        // The entries of the old value are kept, as the update may be rolled back and older
+        // transactions may still read it.
+        const auto propertyPos = nodeUpdateState.propertyVector.state->getSelVector()[0];
+        if (!nodeUpdateState.propertyVector.isNull(propertyPos)) {
+            std::shared_lock lck{secondaryIndexesMtx};
+            for (auto& index : secondaryIndexes) {
+                if (index->getColumnID() == nodeUpdateState.columnID) {
+                    index->insert({SecondaryIndex::Entry{
+                        index->getKey(nodeUpdateState.propertyVector, propertyPos), nodeOffset}});
+                }
+            }
+        }
     }
     if (transaction->shouldLogToWAL()) {
         KU_ASSERT(transaction->isWriteTransaction());
@@ -302,7 +327,29 @@ void NodeTable::dropColumn(Transaction* transaction, column_id_t columnID) {
 std::pair<offset_t, offset_t> NodeTable::appendToLastNodeGroup(Transaction* transaction,
     ChunkedNodeGroup& chunkedGroup) {
     hasChanges = true;
-    return nodeGroups->appendToLastNodeGroupAndFlushWhenFull(transaction, chunkedGroup);
+    const auto [startOffset, numAppended] =
+        nodeGroups->appendToLastNodeGroupAndFlushWhenFull(transaction, chunkedGroup);
+    std::shared_lock lck{secondaryIndexesMtx};
+    for (auto& index : secondaryIndexes) {
+        const auto& keyChunk = chunkedGroup.getColumnChunk(index->getColumnID()).getData();
+        std::vector<LogicalType> types;
+        types.push_back(keyChunk.getDataType().copy());
+        const auto dataChunk = constructDataChunk(types);
+        ValueVector nodeIDVector(LogicalType::INTERNAL_ID());
+        nodeIDVector.setState(dataChunk->state);
+        auto& keyVector = dataChunk->getValueVectorMutable(0);
+        for (offset_t offset = 0; offset < numAppended; offset += DEFAULT_VECTOR_CAPACITY) {
+            const auto numValues = std::min(DEFAULT_VECTOR_CAPACITY, numAppended - offset);
+            keyVector.resetAuxiliaryBuffer();
+            keyChunk.scan(keyVector, offset, numValues);
+            for (auto i = 0u; i < numValues; i++) {
+                nodeIDVector.setValue(i, nodeID_t{startOffset + offset + i, tableID});
+            }
+            dataChunk->state->getSelVectorUnsafe().setSelSize(numValues);
+            index->insert(nodeIDVector, keyVector);
+        }
+    }
+    return {startOffset, numAppended};
 }
 
 void NodeTable::commit(Transaction* transaction, LocalTable* localTable) {
@@ -336,10 +383,16 @@ void NodeTable::commit(Transaction* transaction, LocalTable* localTable) {
         numLocalRows += localNodeGroup->getNumRows();
     }
     // 3. Scan pk column for newly inserted tuples that are not deleted and insert into pk index.
+    // The columns of secondary indexes are scanned along, and their values inserted too.
+    std::shared_lock lck{secondaryIndexesMtx};
     std::vector<column_id_t> columnIDs{getPKColumnID()};
     std::vector<LogicalType> types;
     types.push_back(columns[pkColumnID]->getDataType().copy());
-    const auto dataChunk = constructDataChunk({types});
+    for (auto& index : secondaryIndexes) {
+        columnIDs.push_back(index->getColumnID());
+        types.push_back(columns[index->getColumnID()]->getDataType().copy());
+    }
+    const auto dataChunk = constructDataChunk(types);
     ValueVector nodeIDVector(LogicalType::INTERNAL_ID());
     nodeIDVector.setState(dataChunk->state);
     const auto numNodeGroupsToScan = localNodeTable.getNumNodeGroups();
@@ -365,6 +418,9 @@ void NodeTable::commit(Transaction* transaction, LocalTable* localTable) {
                 nodeIDVector.setValue(i, nodeID_t{startNodeOffset + i, tableID});
             }
             insertPK(transaction, nodeIDVector, *scanState->outputVectors[0]);
+            for (auto i = 0u; i < secondaryIndexes.size(); i++) {
+                secondaryIndexes[i]->insert(nodeIDVector, *scanState->outputVectors[i + 1]);
+            }
             startNodeOffset += scanResult.numRows;
         }
         nodeGroupToScan++;
@@ -390,7 +446,11 @@ void NodeTable::insertPK(const Transaction* transaction, const ValueVector& node
     }
 }
 
-void NodeTable::checkpoint(Serializer& ser, TableCatalogEntry* tableEntry) {
+void NodeTable::checkpoint(main::ClientContext& context, Serializer& ser,
+    TableCatalogEntry* tableEntry) {
+    // The indexes are checkpointed first, as the values of the nodes written in place by the node
+    // group checkpoint can't be scanned until the shadow pages are applied.
+    checkpointSecondaryIndexes(context);
     if (hasChanges) {
         // Deleted columns are vaccumed and not checkpointed or serialized.
         std::vector<std::unique_ptr<Column>> checkpointColumns;
@@ -402,18 +462,73 @@ void NodeTable::checkpoint(Serializer& ser, TableCatalogEntry* tableEntry) {
         }
         NodeGroupCheckpointState state{columnIDs, std::move(checkpointColumns), *dataFH,
             memoryManager};
-        nodeGroups->checkpoint(*memoryManager, state);
+        state.rewriteThreshold = context.getDBConfig()->nodeGroupRewriteThreshold;
+        state.pkColumnIdx = std::find(columnIDs.begin(), columnIDs.end(), pkColumnID) -
+                            columnIDs.begin();
+        nodeGroups->checkpointInParallel(context, *memoryManager, state);
         pkIndex->checkpoint();
         hasChanges = false;
         columns = std::move(state.columns);
         tableEntry->vacuumColumnIDs(0);
+        // Column IDs change when the table's columns are vacuumed.
+        std::shared_lock lck{secondaryIndexesMtx};
+        for (auto& index : secondaryIndexes) {
+            index->setColumnID(tableEntry->getColumnID(index->getPropertyName()));
+        }
     }
     serialize(ser);
 }
 
+void NodeTable::checkpointSecondaryIndexes(main::ClientContext& context) {
+    std::unique_lock lck{secondaryIndexesMtx};
+    const auto indexEntries =
+        context.getCatalog()->getIndexEntries(&DUMMY_CHECKPOINT_TRANSACTION, tableID);
+    // Drop the indexes which were dropped from the catalog, or whose creation was rolled back, and
+    // free the pages of their DiskArrays.
+    auto& freeChunkMap = dataFH->getFreeChunkMap();
+    std::erase_if(secondaryIndexes, [&](const auto& index) {
+        if (std::any_of(indexEntries.begin(), indexEntries.end(),
+                [&](const auto* entry) { return entry->getOID() == index->getIndexID(); })) {
+            return false;
+        }
+        for (const auto pageIdx : index->getPageIdxs()) {
+            freeChunkMap.addFreeChunk(pageIdx, 1 /* numPages */);
+        }
+        return true;
+    });
+    // The indexes have no new or dead entries unless the table changed since the last checkpoint.
+    if (!hasChanges) {
+        return;
+    }
+    for (auto& index : secondaryIndexes) {
+        std::vector<SecondaryIndex::Entry> liveEntries;
+        scanColumn(&DUMMY_CHECKPOINT_TRANSACTION, TableScanSource::COMMITTED, index->getColumnID(),
+            [&](const ValueVector& nodeIDVector, const ValueVector& keyVector) {
+                index->appendEntries(nodeIDVector, keyVector, liveEntries);
+            });
+        std::sort(liveEntries.begin(), liveEntries.end());
+        index->checkpoint(liveEntries);
+    }
+}
+
+void NodeTable::collectOnDiskChunks(const TableCatalogEntry& tableEntry,
+    std::vector<ColumnChunkData*>& chunks) const {
+    std::vector<column_id_t> columnIDs;
+    for (auto& property : tableEntry.getProperties()) {
+        columnIDs.push_back(tableEntry.getColumnID(property.getName()));
+    }
+    nodeGroups->collectOnDiskChunks(columnIDs, chunks);
+}
+
 void NodeTable::serialize(Serializer& serializer) const {
     Table::serialize(serializer);
     nodeGroups->serialize(serializer);
+    std::shared_lock lck{secondaryIndexesMtx};
+    serializer.writeDebuggingInfo("num_secondary_indexes");
+    serializer.write<uint64_t>(secondaryIndexes.size());
+    for (auto& index : secondaryIndexes) {
+        index->serialize(serializer);
+    }
 }
 
 bool NodeTable::isVisible(const Transaction* transaction, offset_t offset) const {
@@ -428,6 +543,108 @@ bool NodeTable::isVisibleNoLock(const Transaction* transaction, offset_t offset)
     return nodeGroup->isVisible(transaction, offsetInGroup);
 }
 
+SecondaryIndex* NodeTable::getSecondaryIndex(oid_t indexID) const {
+    std::shared_lock lck{secondaryIndexesMtx};
+    for (auto& index : secondaryIndexes) {
+        if (index->getIndexID() == indexID) {
+            return index.get();
+        }
+    }
+    return nullptr;
+}
+
+void NodeTable::scanColumn(Transaction* transaction, TableScanSource source, column_id_t columnID,
+    const std::function<void(const ValueVector&, const ValueVector&)>& func) {
+    node_group_idx_t numNodeGroups = 0;
+    if (source == TableScanSource::COMMITTED) {
+        numNodeGroups = nodeGroups->getNumNodeGroups();
+    } else {
+        const auto localTable = transaction->getLocalStorage()->getLocalTable(tableID,
+            LocalStorage::NotExistAction::RETURN_NULL);
+        if (!localTable) {
+            return;
+        }
+        numNodeGroups = localTable->cast<LocalNodeTable>().getNumNodeGroups();
+    }
+    std::vector<LogicalType> types;
+    types.push_back(columns[columnID]->getDataType().copy());
+    const auto dataChunk = constructDataChunk(types);
+    ValueVector nodeIDVector(LogicalType::INTERNAL_ID());
+    nodeIDVector.setState(dataChunk->state);
+    NodeTableScanState scanState(tableID, {columnID}, {columns[columnID].get()});
+    scanState.nodeIDVector = &nodeIDVector;
+    scanState.outputVectors.push_back(&dataChunk->getValueVectorMutable(0));
+    scanState.outState = dataChunk->state.get();
+    for (node_group_idx_t nodeGroupIdx = 0; nodeGroupIdx < numNodeGroups; nodeGroupIdx++) {
+        scanState.source = source;
+        scanState.nodeGroupIdx = nodeGroupIdx;
+        initScanState(transaction, scanState);
+        while (scanInternal(transaction, scanState)) {
+            func(nodeIDVector, *scanState.outputVectors[0]);
+        }
+    }
+}
+
+void NodeTable::createSecondaryIndex(Transaction* transaction, const IndexCatalogEntry& indexEntry,
+    column_id_t columnID) {
+    auto index = std::make_unique<SecondaryIndex>(indexEntry.getOID(), indexEntry.getIndexType(),
+        indexEntry.getPropertyName(), columns[columnID]->getDataType().getPhysicalType(), columnID,
+        *dataFH, shadowFile);
+    // Committed nodes which the transaction updated or deleted are indexed with both their current
+    // and their last committed values, as the transaction may still be rolled back.
+    auto committedTransaction = Transaction(TransactionType::READ_ONLY,
+        Transaction::DUMMY_TRANSACTION_ID, transaction->getStartTS());
+    for (auto* scanTransaction : {transaction, &committedTransaction}) {
+        std::vector<SecondaryIndex::Entry> entries;
+        scanColumn(scanTransaction, TableScanSource::COMMITTED, columnID,
+            [&](const ValueVector& nodeIDVector, const ValueVector& keyVector) {
+                index->appendEntries(nodeIDVector, keyVector, entries);
+            });
+        index->insert(std::move(entries));
+    }
+    std::unique_lock lck{secondaryIndexesMtx};
+    // The creation of an index with the same ID may have been rolled back.
+    std::erase_if(secondaryIndexes,
+        [&](const auto& other) { return other->getIndexID() == indexEntry.getOID(); });
+    secondaryIndexes.push_back(std::move(index));
+    hasChanges = true;
+}
+
+void NodeTable::lookupSecondaryIndex(Transaction* transaction, oid_t indexID,
+    const ValueVector* lowerBoundVector, const ValueVector* upperBoundVector,
+    std::vector<offset_t>& result) {
+    const auto index = getSecondaryIndex(indexID);
+    KU_ASSERT(index);
+    const auto [lowKey, highKey] = index->getKeyRange(lowerBoundVector, upperBoundVector);
+    index->lookupRange(lowKey, highKey, result);
+    // Nodes inserted by the transaction are only indexed when it commits.
+    if (!transaction->getLocalStorage()) {
+        return;
+    }
+    scanColumn(transaction, TableScanSource::UNCOMMITTED, index->getColumnID(),
+        [&](const ValueVector& nodeIDVector, const ValueVector& localKeyVector) {
+            const auto& selVector = localKeyVector.state->getSelVector();
+            for (auto i = 0u; i < selVector.getSelSize(); i++) {
+                const auto localPos = selVector[i];
+                if (localKeyVector.isNull(localPos)) {
+                    continue;
+                }
+                const auto key = index->getKey(localKeyVector, localPos);
+                if (key >= lowKey && key <= highKey) {
+                    result.push_back(nodeIDVector.readNodeOffset(localPos));
+                }
+            }
+        });
+}
+
+uint64_t NodeTable::countSecondaryIndexEntries(oid_t indexID, const ValueVector* lowerBoundVector,
+    const ValueVector* upperBoundVector) {
+    const auto index = getSecondaryIndex(indexID);
+    KU_ASSERT(index);
+    const auto [lowKey, highKey] = index->getKeyRange(lowerBoundVector, upperBoundVector);
+    return index->countRange(lowKey, highKey);
+}
+
 bool NodeTable::lookupPK(const Transaction* transaction, ValueVector* keyVector, uint64_t vectorPos,
     offset_t& result) const {
     if (transaction->getLocalStorage()) {
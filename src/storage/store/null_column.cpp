@@ -3,6 +3,7 @@
 #include "common/vector/value_vector.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/compression/compression.h"
+#include "storage/compression/rle_compression.h"
 #include "transaction/transaction.h"
 
 using namespace kuzu::common;
@@ -23,6 +24,13 @@ struct NullColumnFunc {
             ConstantCompression::decompressValues(reinterpret_cast<uint8_t*>(&value), 0 /*offset*/,
                 1 /*numValues*/, PhysicalTypeID::BOOL, 1 /*numBytesPerValue*/, metadata);
             resultVector->setNullRange(posInVector, numValuesToRead, value);
+        } else if (metadata.compression == CompressionType::RLE) {
+            // Nulls are set a run at a time instead of bit by bit
+            RunLengthEncoding::forEachRun(metadata, pageCursor.elemPosInPage, numValuesToRead,
+                [&](StorageValue value, uint64_t pos, uint64_t numValuesInRun) {
+                    resultVector->setNullRange(posInVector + pos, numValuesInRun,
+                        value.get<bool>());
+                });
         } else {
             resultVector->setNullFromBits(reinterpret_cast<const uint64_t*>(frame),
                 pageCursor.elemPosInPage, posInVector, numValuesToRead);
@@ -473,7 +473,7 @@ void RelTable::prepareCommitForNodeGroup(const Transaction* transaction, NodeGro
     }
 }
 
-void RelTable::checkpoint(Serializer& ser, TableCatalogEntry* tableEntry) {
+void RelTable::checkpoint(main::ClientContext&, Serializer& ser, TableCatalogEntry* tableEntry) {
     if (hasChanges) {
         // Deleted columns are vaccumed and not checkpointed or serialized.
         std::vector<column_id_t> columnIDs;
@@ -1,5 +1,7 @@
 #include "storage/store/string_chunk_data.h"
 
+#include <algorithm>
+
 #include "common/data_chunk/sel_vector.h"
 #include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
@@ -260,6 +262,20 @@ void StringChunkData::finalize() {
     dictionaryChunk = std::move(newDictionaryChunk);
 }
 
+ColumnChunkMetadata StringChunkData::getMetadataToFlush() const {
+    auto metadata = ColumnChunkData::getMetadataToFlush();
+    // Values are de-duplicated in the dictionary, so its size bounds the number of distinct values
+    auto zoneMap = std::make_shared<StringZoneMap>(
+        std::min(dictionaryChunk->getOffsetChunk()->getNumValues(), getNumValues()));
+    for (auto i = 0u; i < getNumValues(); i++) {
+        if (!nullData->isNull(i)) {
+            zoneMap->add(getValue<std::string_view>(i));
+        }
+    }
+    metadata.stringZoneMap = std::move(zoneMap);
+    return metadata;
+}
+
 void StringChunkData::flush(FileHandle& dataFH) {
     ColumnChunkData::flush(dataFH);
     indexColumnChunk->flush(dataFH);
@@ -295,6 +311,17 @@ std::vector<struct std::pair<page_idx_t, page_idx_t>> StringChunkData::getAllChu
     return chunkInfo;
 }
 
+void StringChunkData::collectOnDiskChunks(std::vector<ColumnChunkData*>& chunks)
+{
+    if (getResidencyState() != ResidencyState::ON_DISK) {
+        return;
+    }
+    ColumnChunkData::collectOnDiskChunks(chunks);
+    indexColumnChunk->collectOnDiskChunks(chunks);
+    dictionaryChunk->getStringDataChunk()->collectOnDiskChunks(chunks);
+    dictionaryChunk->getOffsetChunk()->collectOnDiskChunks(chunks);
+}
+
 void StringChunkData::serialize(Serializer& serializer) const {
     ColumnChunkData::serialize(serializer);
     serializer.writeDebuggingInfo("index_column_chunk");
@@ -52,6 +52,15 @@ std::unique_ptr<ColumnChunkData> StringColumn::flushChunkData(const ColumnChunkD
     flushedStringData.setIndexChunk(
         Column::flushChunkData(*stringChunk.getIndexColumnChunk(), dataFH));
     auto& dictChunk = stringChunk.getDictionaryChunk();
+    if (auto encoded = dictChunk.encodeWithFSST()) {
+        flushedStringData.getDictionaryChunk().setOffsetChunk(
+            Column::flushChunkData(*encoded->offsetChunk, dataFH));
+        auto flushedStringDataChunk = Column::flushChunkData(*encoded->stringDataChunk, dataFH);
+        DictionaryChunk::setFSSTMetadata(*flushedStringDataChunk, std::move(encoded->symbolTable));
+        flushedStringData.getDictionaryChunk().setStringDataChunk(
+            std::move(flushedStringDataChunk));
+        return flushedChunkData;
+    }
     flushedStringData.getDictionaryChunk().setOffsetChunk(
         Column::flushChunkData(*dictChunk.getOffsetChunk(), dataFH));
     flushedStringData.getDictionaryChunk().setStringDataChunk(
@@ -88,7 +97,7 @@ void StringColumn::lookupInternal(Transaction* transaction, const ChunkState& st
     string_index_t index = 0;
     indexColumn->scan(transaction, getChildState(state, ChildStateIndex::INDEX), offsetInChunk,
         offsetInChunk + 1, reinterpret_cast<uint8_t*>(&index));
-    std::vector<std::pair<string_index_t, uint64_t>> offsetsToScan(1);
+    std::vector<std::pair<string_index_t, uint64_t>> offsetsToScan;
     offsetsToScan.emplace_back(index, posInVector);
     dictionary.scan(transaction, getChildState(state, ChildStateIndex::OFFSET),
         getChildState(state, ChildStateIndex::DATA), offsetsToScan, resultVector,
@@ -100,6 +109,11 @@ void StringColumn::write(ColumnChunkData& persistentChunk, ChunkState& state, of
     auto& stringPersistentChunk = persistentChunk.cast<StringChunkData>();
     numValues = std::min(numValues, data->getNumValues() - srcOffset);
     auto& strChunkToWriteFrom = data->cast<StringChunkData>();
+    auto& metadata = persistentChunk.getMetadata();
+    std::shared_ptr<StringZoneMap> zoneMap;
+    if (metadata.stringZoneMap) {
+        zoneMap = std::make_shared<StringZoneMap>(*metadata.stringZoneMap);
+    }
     std::vector<string_index_t> indices;
     indices.resize(numValues);
     for (auto i = 0u; i < numValues; i++) {
@@ -108,6 +122,9 @@ void StringColumn::write(ColumnChunkData& persistentChunk, ChunkState& state, of
             continue;
         }
         const auto strVal = strChunkToWriteFrom.getValue<std::string_view>(i + srcOffset);
+        if (zoneMap) {
+            zoneMap->add(strVal);
+        }
         indices[i] = dictionary.append(persistentChunk.cast<StringChunkData>().getDictionaryChunk(),
             state, strVal);
     }
@@ -120,8 +137,10 @@ void StringColumn::write(ColumnChunkData& persistentChunk, ChunkState& state, of
     auto [min, max] = std::minmax_element(indices.begin(), indices.end());
     auto minWritten = StorageValue(*min);
     auto maxWritten = StorageValue(*max);
-    updateStatistics(persistentChunk.getMetadata(), dstOffset + numValues - 1, minWritten,
-        maxWritten);
+    updateStatistics(metadata, dstOffset + numValues - 1, minWritten, maxWritten);
+    if (zoneMap) {
+        metadata.stringZoneMap = std::move(zoneMap);
+    }
     indexColumn->updateStatistics(stringPersistentChunk.getIndexColumnChunk()->getMetadata(),
         dstOffset + numValues - 1, minWritten, maxWritten);
 }
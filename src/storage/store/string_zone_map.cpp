@@ -0,0 +1,117 @@
+#include "storage/store/string_zone_map.h"
+
+#include <cstring>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/utils.h"
+#include "function/hash/hash_functions.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+// Odd constants used to pick a bit in each word of a block, from the parquet split block Bloom
+// filter.
+static constexpr uint32_t BLOOM_FILTER_SALTS[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU,
+    0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+// The filter is persisted, so unlike Hash::operation the hash doesn't depend on the signedness of
+// char.
+static uint64_t hashString(std::string_view value) {
+    uint64_t hash = 0;
+    uint64_t pos = 0;
+    for (; pos + sizeof(uint64_t) <= value.size(); pos += sizeof(uint64_t)) {
+        uint64_t block = 0;
+        memcpy(&block, value.data() + pos, sizeof(uint64_t));
+        hash = function::combineHashScalar(hash, function::murmurhash64(block));
+    }
+    uint64_t last = 0;
+    for (auto i = 0u; pos + i < value.size(); i++) {
+        last |= static_cast<uint64_t>(static_cast<uint8_t>(value[pos + i])) << (i * 8);
+    }
+    return function::combineHashScalar(hash, function::murmurhash64(last ^ value.size()));
+}
+
+StringZoneMap::StringZoneMap(uint64_t numDistinctValues) {
+    const auto numBits = numDistinctValues * BLOOM_FILTER_BITS_PER_VALUE;
+    if (numBits == 0 || numBits > MAX_BLOOM_FILTER_SIZE * 8) {
+        return;
+    }
+    const auto numBlocks = ceilDiv(numBits, WORDS_PER_BLOCK * sizeof(uint32_t) * 8);
+    bloomFilter.resize(numBlocks * WORDS_PER_BLOCK, 0);
+}
+
+void StringZoneMap::add(std::string_view value) {
+    const auto prefix = value.substr(0, PREFIX_LENGTH);
+    if (numValues == 0) {
+        minPrefix = prefix;
+        maxPrefix = prefix;
+    } else if (prefix < minPrefix) {
+        minPrefix = prefix;
+    } else if (prefix > maxPrefix) {
+        maxPrefix = prefix;
+    }
+    numValues++;
+    if (!hasBloomFilter()) {
+        return;
+    }
+    const auto hash = hashString(value);
+    const auto numBlocks = bloomFilter.size() / WORDS_PER_BLOCK;
+    auto* block = &bloomFilter[((hash >> 32) * numBlocks >> 32) * WORDS_PER_BLOCK];
+    const auto key = static_cast<uint32_t>(hash);
+    for (auto i = 0u; i < WORDS_PER_BLOCK; i++) {
+        block[i] |= 1u << ((key * BLOOM_FILTER_SALTS[i]) >> 27);
+    }
+}
+
+bool StringZoneMap::bloomFilterMayContain(std::string_view value) const {
+    if (!hasBloomFilter()) {
+        return true;
+    }
+    const auto hash = hashString(value);
+    const auto numBlocks = bloomFilter.size() / WORDS_PER_BLOCK;
+    const auto* block = &bloomFilter[((hash >> 32) * numBlocks >> 32) * WORDS_PER_BLOCK];
+    const auto key = static_cast<uint32_t>(hash);
+    for (auto i = 0u; i < WORDS_PER_BLOCK; i++) {
+        if (!(block[i] & (1u << ((key * BLOOM_FILTER_SALTS[i]) >> 27)))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The minimum prefix is a lower bound of the values. The maximum prefix is not an upper bound, but
+// truncating is monotonic, so a value whose prefix is greater than it is greater than every value.
+bool StringZoneMap::mayContainEqual(std::string_view value) const {
+    return hasValues() && value >= minPrefix && value.substr(0, PREFIX_LENGTH) <= maxPrefix &&
+           bloomFilterMayContain(value);
+}
+
+bool StringZoneMap::mayContainGreaterOrEqual(std::string_view value) const {
+    return hasValues() && value.substr(0, PREFIX_LENGTH) <= maxPrefix;
+}
+
+bool StringZoneMap::mayContainLess(std::string_view value, bool orEqual) const {
+    return hasValues() && (orEqual ? value >= minPrefix : value > minPrefix);
+}
+
+void StringZoneMap::serialize(Serializer& serializer) const {
+    serializer.write(numValues);
+    serializer.write(minPrefix);
+    serializer.write(maxPrefix);
+    serializer.serializeVector(bloomFilter);
+}
+
+StringZoneMap StringZoneMap::deserialize(Deserializer& deserializer) {
+    StringZoneMap ret;
+    deserializer.deserializeValue(ret.numValues);
+    deserializer.deserializeValue(ret.minPrefix);
+    deserializer.deserializeValue(ret.maxPrefix);
+    deserializer.deserializeVector(ret.bloomFilter);
+    return ret;
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -82,6 +82,17 @@ std::vector<struct std::pair<page_idx_t, page_idx_t>> StructChunkData::getAllChu
     return chunkInfo;
 }
 
+void StructChunkData::collectOnDiskChunks(std::vector<ColumnChunkData*>& chunks)
+{
+    if (getResidencyState() != ResidencyState::ON_DISK) {
+        return;
+    }
+    ColumnChunkData::collectOnDiskChunks(chunks);
+    for (const auto& childChunk : childChunks) {
+        childChunk->collectOnDiskChunks(chunks);
+    }
+}
+
 void StructChunkData::serialize(Serializer& serializer) const {
     ColumnChunkData::serialize(serializer);
     serializer.writeDebuggingInfo("struct_children");
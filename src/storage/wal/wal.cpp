@@ -1,5 +1,9 @@
 #include "storage/wal/wal.h"
 
+#include <bit>
+#include <chrono>
+#include <thread>
+
 #include "binder/ddl/bound_alter_info.h"
 #include "binder/ddl/bound_create_table_info.h"
 #include "catalog/catalog_entry/sequence_catalog_entry.h"
@@ -19,7 +23,7 @@ namespace storage {
 
 WAL::WAL(const std::string& directory, bool readOnly, VirtualFileSystem* vfs,
     main::ClientContext* context)
-    : directory{directory}, vfs{vfs} {
+    : directory{directory}, vfs{vfs}, lastCommitSeq{0}, syncedCommitSeq{0}, hasSyncLeader{false} {
     if (main::DBConfig::isDBPathInMemory(directory)) {
         return;
     }
@@ -43,13 +47,71 @@ void WAL::logBeginTransaction() {
     addNewWALRecordNoLock(walRecord);
 }
 
-void WAL::logAndFlushCommit() {
+uint64_t WAL::logCommit() {
     std::unique_lock<std::mutex> lck{mtx};
-    // Flush all pages before committing to make sure that commits only show up in the file when
-    // their data is also written.
+    // The records of the transaction are written before its commit record, so a commit only shows
+    // up in the file when its data is also written.
     CommitRecord walRecord;
     addNewWALRecordNoLock(walRecord);
-    flushAllPages();
+    return ++lastCommitSeq;
+}
+
+void WAL::syncCommit(uint64_t commitSeq, uint64_t maxDelayInMicros) {
+    std::unique_lock<std::mutex> lck{groupCommitMtx};
+    while (syncedCommitSeq < commitSeq) {
+        if (hasSyncLeader) {
+            // Another thread is syncing. Its batch may not include our commit, in which case we
+            // compete for leading the next batch after it finishes.
+            groupCommitCV.wait(lck);
+            continue;
+        }
+        hasSyncLeader = true;
+        lck.unlock();
+        if (maxDelayInMicros > 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(maxDelayInMicros));
+        }
+        uint64_t batchEndSeq = 0;
+        uint64_t syncLatencyInMicros = 0;
+        try {
+            std::unique_lock<std::mutex> walLck{mtx};
+            batchEndSeq = lastCommitSeq;
+            bufferedWriter->flush();
+            walLck.unlock();
+            // Syncing does not block other threads from appending records.
+            const auto startTime = std::chrono::steady_clock::now();
+            bufferedWriter->getFileInfo().syncFile();
+            syncLatencyInMicros = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - startTime)
+                                      .count();
+        } catch (...) {
+            lck.lock();
+            hasSyncLeader = false;
+            groupCommitCV.notify_all();
+            throw;
+        }
+        lck.lock();
+        hasSyncLeader = false;
+        if (batchEndSeq > syncedCommitSeq) {
+            const auto batchSize = batchEndSeq - syncedCommitSeq;
+            groupCommitStats.numSyncedCommits += batchSize;
+            groupCommitStats.maxBatchSize = std::max(groupCommitStats.maxBatchSize, batchSize);
+            syncedCommitSeq = batchEndSeq;
+        }
+        groupCommitStats.numSyncs++;
+        const auto bucketIdx = std::min<size_t>(std::bit_width(syncLatencyInMicros),
+            NUM_WAL_SYNC_LATENCY_BUCKETS - 1);
+        groupCommitStats.syncLatencyHistogram[bucketIdx]++;
+        groupCommitCV.notify_all();
+    }
+}
+
+void WAL::markCommitsSynced(uint64_t commitSeq) {
+    std::unique_lock<std::mutex> lck{groupCommitMtx};
+    if (commitSeq > syncedCommitSeq) {
+        groupCommitStats.numSyncedCommits += commitSeq - syncedCommitSeq;
+        syncedCommitSeq = commitSeq;
+    }
+    groupCommitCV.notify_all();
 }
 
 void WAL::logRollback() {
@@ -62,7 +124,11 @@ void WAL::logAndFlushCheckpoint() {
     std::unique_lock<std::mutex> lck{mtx};
     CheckpointRecord walRecord;
     addNewWALRecordNoLock(walRecord);
-    flushAllPages();
+    flushAllPagesNoLock();
+    const auto commitSeq = lastCommitSeq;
+    lck.unlock();
+    // The sync also covers all commits that are still waiting for their batch.
+    markCommitsSynced(commitSeq);
 }
 
 void WAL::logCreateTableEntryRecord(BoundCreateTableInfo tableInfo) {
@@ -145,12 +211,19 @@ void WAL::logUpdateSequenceRecord(sequence_id_t sequenceID, uint64_t kCount) {
 }
 
 void WAL::clearWAL() {
+    // A group commit leader may still be flushing commits that were synced by the checkpoint.
+    std::unique_lock<std::mutex> lck{mtx};
     bufferedWriter->getFileInfo().truncate(0);
     bufferedWriter->resetOffsets();
     updatedTables.clear();
 }
 
 void WAL::flushAllPages() {
+    std::unique_lock<std::mutex> lck{mtx};
+    flushAllPagesNoLock();
+}
+
+void WAL::flushAllPagesNoLock() {
     bufferedWriter->flush();
     bufferedWriter->getFileInfo().syncFile();
 }
@@ -1,6 +1,7 @@
 #include "storage/wal_replayer.h"
 
 #include "binder/binder.h"
+#include "catalog/catalog_entry/index_catalog_entry.h"
 #include "catalog/catalog_entry/scalar_macro_catalog_entry.h"
 #include "catalog/catalog_entry/sequence_catalog_entry.h"
 #include "catalog/catalog_entry/table_catalog_entry.h"
@@ -153,6 +154,20 @@ void WALReplayer::replayCreateCatalogEntryRecord(const WALRecord& walRecord) con
         clientContext.getCatalog()->createType(clientContext.getTx(), typeEntry.getName(),
             typeEntry.getLogicalType().copy());
     } break;
+    case CatalogEntryType::INDEX_ENTRY: {
+        auto& indexEntry = createEntryRecord.ownedCatalogEntry->constCast<IndexCatalogEntry>();
+        const auto catalog = clientContext.getCatalog();
+        catalog->createIndex(clientContext.getTx(), indexEntry.getName(), indexEntry.getTableID(),
+            indexEntry.getPropertyName(), indexEntry.getIndexType());
+        const auto tableEntry =
+            catalog->getTableCatalogEntry(clientContext.getTx(), indexEntry.getTableID());
+        auto& table = clientContext.getStorageManager()
+                          ->getTable(indexEntry.getTableID())
+                          ->cast<NodeTable>();
+        table.createSecondaryIndex(clientContext.getTx(),
+            *catalog->getIndexCatalogEntry(clientContext.getTx(), indexEntry.getName()),
+            tableEntry->getColumnID(indexEntry.getPropertyName()));
+    } break;
     default: {
         KU_UNREACHABLE;
     }
@@ -174,6 +189,9 @@ void WALReplayer::replayDropCatalogEntryRecord(const WALRecord& walRecord) const
     case CatalogEntryType::SEQUENCE_ENTRY: {
         clientContext.getCatalog()->dropSequence(clientContext.getTx(), entryID);
     } break;
+    case CatalogEntryType::INDEX_ENTRY: {
+        clientContext.getCatalog()->dropIndex(clientContext.getTx(), entryID);
+    } break;
     default: {
         KU_UNREACHABLE;
     }
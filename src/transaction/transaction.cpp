@@ -51,7 +51,7 @@ void Transaction::commit(storage::WAL* wal) const {
     undoBuffer->commit(commitTS);
     if (isWriteTransaction() && shouldLogToWAL()) {
         KU_ASSERT(wal);
-        wal->logAndFlushCommit();
+        wal->logCommit();
     }
 }
 
@@ -107,7 +107,8 @@ void Transaction::pushCatalogEntry(CatalogSet& catalogSet, CatalogEntry& catalog
         wal->logCreateCatalogEntryRecord(newCatalogEntry);
     } break;
     case CatalogEntryType::SCALAR_MACRO_ENTRY:
-    case CatalogEntryType::TYPE_ENTRY: {
+    case CatalogEntryType::TYPE_ENTRY:
+    case CatalogEntryType::INDEX_ENTRY: {
         KU_ASSERT(
             catalogEntry.getType() == CatalogEntryType::DUMMY_ENTRY && catalogEntry.isDeleted());
         wal->logCreateCatalogEntryRecord(newCatalogEntry);
@@ -136,6 +137,9 @@ void Transaction::pushCatalogEntry(CatalogSet& catalogSet, CatalogEntry& catalog
             const auto sequenceCatalogEntry = catalogEntry.constPtrCast<SequenceCatalogEntry>();
             wal->logDropCatalogEntryRecord(sequenceCatalogEntry->getOID(), catalogEntry.getType());
         } break;
+        case CatalogEntryType::INDEX_ENTRY: {
+            wal->logDropCatalogEntryRecord(catalogEntry.getOID(), catalogEntry.getType());
+        } break;
         case CatalogEntryType::SCALAR_FUNCTION_ENTRY: {
             // DO NOTHING. We don't persistent function entries.
         } break;
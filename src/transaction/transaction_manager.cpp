@@ -52,6 +52,7 @@ void TransactionManager::commit(main::ClientContext& clientContext) {
     std::unique_lock<std::mutex> lck{mtxForSerializingPublicFunctionCalls};
     clientContext.cleanUP();
     const auto transaction = clientContext.getTx();
+    uint64_t commitSeqToSync = 0;
     switch (transaction->getType()) {
     case TransactionType::READ_ONLY: {
         activeReadOnlyTransactions.erase(transaction->getID());
@@ -61,15 +62,43 @@ void TransactionManager::commit(main::ClientContext& clientContext) {
         lastTimestamp++;
         transaction->commitTS = lastTimestamp;
         transaction->commit(&wal);
+        if (transaction->shouldLogToWAL()) {
+            // Commits are serialized by lck, so the last commit record is the one of this
+            // transaction.
+            commitSeqToSync = wal.getLastCommitSeq();
+        }
         activeWriteTransactions.erase(transaction->getID());
-        if (transaction->shouldForceCheckpoint() || canAutoCheckpoint(clientContext)) {
+        if (transaction->shouldForceCheckpoint()) {
             checkpointNoLock(clientContext);
+        } else if (canAutoCheckpoint(clientContext)) {
+            if (!clientContext.getDBConfig()->nonBlockingAutoCheckpoint) {
+                checkpointNoLock(clientContext);
+            } else if (numSkippedAutoCheckpoints >= MAX_NUM_SKIPPED_AUTO_CHECKPOINTS) {
+                // Under a steady read load there is hardly ever a moment without active
+                // transactions, so fall back to waiting for them instead of letting the WAL grow.
+                // This transaction has already committed, so a timeout must not fail it. The next
+                // committing write transaction waits again.
+                try {
+                    checkpointNoLock(clientContext);
+                } catch (const TransactionManagerException&) {}
+            } else if (!tryCheckpointNoLock(clientContext)) {
+                // The WAL stays above the threshold, so a skipped checkpoint is retried by the next
+                // committing write transaction.
+                numSkippedAutoCheckpoints++;
+            }
         }
     } break;
     default: {
         throw TransactionManagerException("Invalid transaction type to commit.");
     }
     }
+    if (commitSeqToSync != 0) {
+        // Wait for the commit record to be durable outside of lck, so that concurrent commits can
+        // share a single sync of the WAL.
+        const auto maxDelayInMicros = clientContext.getDBConfig()->groupCommitMaxDelayInMicros;
+        lck.unlock();
+        wal.syncCommit(commitSeqToSync, maxDelayInMicros);
+    }
 }
 
 // Note: We take in additional `transaction` here is due to that `transactionContext` might be
@@ -124,6 +153,18 @@ void TransactionManager::stopNewTransactionsAndWaitUntilAllTransactionsLeave() {
     }
 }
 
+bool TransactionManager::tryStopNewTransactionsWithoutActiveTransactions() {
+    // A thread holding this lock is starting a new transaction, which we must not wait for.
+    if (!mtxForStartingNewTransactions.try_lock()) {
+        return false;
+    }
+    if (!canCheckpointNoLock()) {
+        mtxForStartingNewTransactions.unlock();
+        return false;
+    }
+    return true;
+}
+
 void TransactionManager::allowReceivingNewTransactions() {
     mtxForStartingNewTransactions.unlock();
 }
@@ -156,6 +197,19 @@ void TransactionManager::checkpointNoLock(main::ClientContext& clientContext) {
     // query stop working on the tasks of the query and these tasks are removed from the
     // query.
     stopNewTransactionsAndWaitUntilAllTransactionsLeave();
+    checkpointWithoutActiveTransactionsNoLock(clientContext);
+}
+
+bool TransactionManager::tryCheckpointNoLock(main::ClientContext& clientContext) {
+    if (!tryStopNewTransactionsWithoutActiveTransactions()) {
+        return false;
+    }
+    checkpointWithoutActiveTransactionsNoLock(clientContext);
+    return true;
+}
+
+void TransactionManager::checkpointWithoutActiveTransactionsNoLock(
+    main::ClientContext& clientContext) {
     // Checkpoint node/relTables, which writes the updated/newly-inserted pages and metadata to
     // disk.
     clientContext.getStorageManager()->checkpoint(clientContext);
@@ -178,6 +232,9 @@ void TransactionManager::checkpointNoLock(main::ClientContext& clientContext) {
     clientContext.getStorageManager()->getShadowFile().clearAll(clientContext);
     StorageUtils::removeWALVersionFiles(clientContext.getDatabasePath(),
         clientContext.getVFSUnsafe());
+    // Reuse the space recycled by this checkpoint and shrink the data file if its tail is free.
+    clientContext.getStorageManager()->finishCheckpoint();
+    numSkippedAutoCheckpoints = 0;
     // Resume receiving new transactions.
     allowReceivingNewTransactions();
 }
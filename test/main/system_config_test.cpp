@@ -74,3 +74,29 @@ TEST_F(SystemConfigTest, testBufferPoolSize) {
     systemConfig->bufferPoolSize = BufferPoolConstants::DEFAULT_BUFFER_POOL_SIZE_FOR_TESTING;
     EXPECT_NO_THROW(auto db = std::make_unique<Database>(databasePath, *systemConfig));
 }
+
+TEST_F(SystemConfigTest, testFreeChunkPolicy) {
+    if (databasePath == "" || databasePath == ":memory:") {
+        return;
+    }
+    auto getPolicy = [](Connection& con) {
+        auto result = con.query("CALL current_setting('free_chunk_policy') RETURN *");
+        return result->getNext()->getValue(0)->toString();
+    };
+    auto db = std::make_unique<Database>(databasePath, *systemConfig);
+    auto con = std::make_unique<Connection>(db.get());
+    assertQuery(*con->query("CALL free_chunk_policy='first_fit'"));
+    assertQuery(*con->query("CHECKPOINT"));
+    con.reset();
+    db.reset();
+    // Without a configured policy, the persisted one is kept.
+    db = std::make_unique<Database>(databasePath, *systemConfig);
+    con = std::make_unique<Connection>(db.get());
+    ASSERT_EQ(getPolicy(*con), "FIRST_FIT");
+    con.reset();
+    db.reset();
+    systemConfig->freeChunkPolicy = FreeChunkPolicy::APPEND_ONLY;
+    db = std::make_unique<Database>(databasePath, *systemConfig);
+    con = std::make_unique<Connection>(db.get());
+    ASSERT_EQ(getPolicy(*con), "APPEND_ONLY");
+}
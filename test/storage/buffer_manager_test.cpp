@@ -1,3 +1,5 @@
+#include <cstring>
+
 #include "common/constants.h"
 #include "common/types/types.h"
 #include "graph_test/graph_test.h"
@@ -6,7 +8,9 @@
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/buffer_manager/spiller.h"
+#include "storage/buffer_manager/vm_region.h"
 #include "storage/enums/residency_state.h"
+#include "storage/storage_manager.h"
 #include "storage/store/chunked_node_group.h"
 #include "storage/store/column_chunk.h"
 
@@ -38,6 +42,114 @@ TEST_F(BufferManagerTest, TestBMUsageForIdenticalQueries) {
     spdlog::info("Memory used after transactions: {}", memoryUsed);
 }
 
+TEST_F(BufferManagerTest, TestPrefetchPages) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    auto bm = getBufferManager(*database);
+    auto dataFH = getStorageManager(*database)->getDataFH();
+    const auto numPages = std::min<page_idx_t>(dataFH->getNumPages(), 16);
+    ASSERT_GT(numPages, 0);
+    page_idx_t numEvictedPages = 0;
+    for (auto pageIdx = 0u; pageIdx < numPages; pageIdx++) {
+        if (dataFH->getPageState(pageIdx)->getState() == PageState::EVICTED) {
+            numEvictedPages++;
+        }
+    }
+    const auto memoryUsed = bm->getUsedMemory();
+    dataFH->prefetchPages(0, numPages);
+    for (auto pageIdx = 0u; pageIdx < numPages; pageIdx++) {
+        ASSERT_NE(dataFH->getPageState(pageIdx)->getState(), PageState::EVICTED);
+    }
+    ASSERT_EQ(memoryUsed + numEvictedPages * PAGE_SIZE, bm->getUsedMemory());
+    // Cached pages are skipped.
+    dataFH->prefetchPages(0, numPages);
+    ASSERT_EQ(memoryUsed + numEvictedPages * PAGE_SIZE, bm->getUsedMemory());
+    auto result = conn->query("MATCH (p:person) RETURN count(*)");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 8);
+}
+
+TEST_F(BufferManagerTest, TestPrefetchWindowIsCapped) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    auto dataFH = getStorageManager(*database)->getDataFH();
+    const auto statsBefore = dataFH->getStats();
+    dataFH->prefetchPages(0, dataFH->getNumPages());
+    const auto statsAfter = dataFH->getStats();
+    ASSERT_LE(statsAfter.numPrefetchedPages - statsBefore.numPrefetchedPages,
+        BufferPoolConstants::MAX_PREFETCH_NUM_PAGES);
+}
+
+TEST_F(BufferManagerTest, TestStreamingReadKeepsPagesMarked) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    auto dataFH = getStorageManager(*database)->getDataFH();
+    auto pageIdx = 0u;
+    while (pageIdx < dataFH->getNumPages() &&
+           dataFH->getPageState(pageIdx)->getState() != PageState::EVICTED) {
+        pageIdx++;
+    }
+    if (pageIdx == dataFH->getNumPages()) {
+        GTEST_SKIP();
+    }
+    const auto statsBefore = dataFH->getStats();
+    dataFH->optimisticReadPage(pageIdx, [](auto) {}, PageAccessHint::STREAMING);
+    // A page read only by streaming reads must stay marked, so it is the first to be evicted.
+    ASSERT_EQ(dataFH->getPageState(pageIdx)->getState(), PageState::MARKED);
+    dataFH->optimisticReadPage(pageIdx, [](auto) {}, PageAccessHint::STREAMING);
+    ASSERT_EQ(dataFH->getPageState(pageIdx)->getState(), PageState::MARKED);
+    // A default read gives the page its second chance back.
+    dataFH->optimisticReadPage(pageIdx, [](auto) {});
+    ASSERT_EQ(dataFH->getPageState(pageIdx)->getState(), PageState::UNLOCKED);
+    const auto statsAfter = dataFH->getStats();
+    ASSERT_EQ(statsAfter.numPageMisses - statsBefore.numPageMisses, 1);
+    ASSERT_EQ(statsAfter.numPageHits - statsBefore.numPageHits, 2);
+}
+
+TEST(VMRegionTest, TestHugePageBackedRegion) {
+    for (auto numaPolicy : {NumaPolicy::DEFAULT, NumaPolicy::INTERLEAVE, NumaPolicy::LOCAL}) {
+        VMRegion region{TEMP_PAGE, 2 * TEMP_PAGE_SIZE * StorageConstants::PAGE_GROUP_SIZE,
+            true /* useHugePages */, numaPolicy};
+        const auto frameGroupIdx = region.addNewFrameGroup();
+        const auto frameIdx = frameGroupIdx * StorageConstants::PAGE_GROUP_SIZE;
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(region.getFrame(frameIdx)) %
+                      VMRegion::HUGE_PAGE_SIZE,
+            0);
+        // Frames must behave the same whether or not the kernel accepted the advice and policy.
+        std::memset(region.getFrame(frameIdx), 0xff, TEMP_PAGE_SIZE);
+        ASSERT_EQ(region.getFrame(frameIdx)[TEMP_PAGE_SIZE - 1], 0xff);
+        region.releaseFrame(frameIdx);
+        ASSERT_EQ(region.getFrame(frameIdx)[0], 0);
+    }
+}
+
+class HugePageBufferManagerTest : public DBTest {
+public:
+    void SetUp() override {
+        BaseGraphTest::SetUp();
+        systemConfig->useHugePages = true;
+        systemConfig->numaPolicy = NumaPolicy::INTERLEAVE;
+        createDBAndConn();
+        initGraph();
+    }
+
+    std::string getInputDir() override {
+        return TestHelper::appendKuzuRootPath("dataset/tinysnb/");
+    }
+};
+
+TEST_F(HugePageBufferManagerTest, TestScanAndJoin) {
+    auto result = conn->query("MATCH (a:person)-[:knows]->(b:person) RETURN count(*)");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 14);
+    result = conn->query("MATCH (a:person), (b:person) WHERE a.ID = b.ID RETURN count(*)");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 8);
+}
+
 class EmptyBufferManagerTest : public DBTest {
 public:
     std::string getInputDir() override {
@@ -83,3 +83,67 @@ TEST(ColumnChunkMetadataTests, DoubleChunkMetadataSerializeThenDeserialize) {
 
     testSerializeThenDeserialize(orig);
 }
+
+TEST(ColumnChunkMetadataTests, StringZoneMapSerializeThenDeserialize) {
+    ColumnChunkMetadata orig{1, 2, 3,
+        CompressionMetadata{StorageValue{}, StorageValue{}, CompressionType::UNCOMPRESSED}};
+    auto zoneMap = std::make_shared<StringZoneMap>(1000);
+    for (auto i = 0u; i < 1000; i++) {
+        zoneMap->add("user" + std::to_string(i * 2) + "@example.com");
+    }
+    orig.stringZoneMap = zoneMap;
+
+    const auto writer = std::make_shared<BufferedSerializer>();
+    Serializer ser{writer};
+    orig.serialize(ser);
+    Deserializer deser{std::make_unique<BufferReader>(writer->getBlobData(), writer->getSize())};
+    const auto deserialized = ColumnChunkMetadata::deserialize(deser);
+    EXPECT_TRUE(orig == deserialized);
+    ASSERT_NE(deserialized.stringZoneMap, nullptr);
+    const auto& result = *deserialized.stringZoneMap;
+    EXPECT_EQ(result.getMinPrefix(), "user0@ex");
+    EXPECT_EQ(result.getMaxPrefix(), "user998@");
+    EXPECT_TRUE(result.hasBloomFilter());
+    uint64_t numFalsePositives = 0;
+    for (auto i = 0u; i < 1000; i++) {
+        // No false negatives
+        EXPECT_TRUE(result.mayContainEqual("user" + std::to_string(i * 2) + "@example.com"));
+        numFalsePositives +=
+            result.mayContainEqual("user" + std::to_string(i * 2 + 1) + "@example.com");
+    }
+    EXPECT_LT(numFalsePositives, 100);
+    EXPECT_FALSE(result.mayContainEqual("admin@example.com"));
+    EXPECT_FALSE(result.mayContainEqual("zed@example.com"));
+    EXPECT_TRUE(result.mayContainGreaterOrEqual("user998@zzz"));
+    EXPECT_FALSE(result.mayContainGreaterOrEqual("user999"));
+    EXPECT_TRUE(result.mayContainLess("user0@ex", true /*orEqual*/));
+    EXPECT_FALSE(result.mayContainLess("user0@ex", false /*orEqual*/));
+    EXPECT_FALSE(result.mayContainLess("user", true /*orEqual*/));
+}
+
+TEST(ColumnChunkMetadataTests, StringZoneMapWithoutValues) {
+    StringZoneMap zoneMap{0};
+    EXPECT_FALSE(zoneMap.hasBloomFilter());
+    EXPECT_FALSE(zoneMap.mayContainEqual(""));
+    EXPECT_FALSE(zoneMap.mayContainGreaterOrEqual(""));
+    EXPECT_FALSE(zoneMap.mayContainLess("a", true /*orEqual*/));
+    // Values added in place without a Bloom filter are only checked against the prefixes
+    zoneMap.add("b");
+    EXPECT_TRUE(zoneMap.mayContainEqual("b"));
+    EXPECT_FALSE(zoneMap.mayContainEqual("bb"));
+    EXPECT_FALSE(zoneMap.mayContainEqual("a"));
+    EXPECT_FALSE(zoneMap.mayContainEqual("c"));
+}
+
+TEST(ColumnChunkMetadataTests, StringZoneMapBloomFilterSizeIsCapped) {
+    constexpr auto maxNumDistinctValues = StringZoneMap::MAX_BLOOM_FILTER_SIZE * 8 /
+                                          StringZoneMap::BLOOM_FILTER_BITS_PER_VALUE;
+    EXPECT_TRUE(StringZoneMap{maxNumDistinctValues}.hasBloomFilter());
+    // The metadata of such a chunk still rules out values outside of the prefixes
+    StringZoneMap zoneMap{maxNumDistinctValues + 1};
+    EXPECT_FALSE(zoneMap.hasBloomFilter());
+    zoneMap.add("b");
+    zoneMap.add("d");
+    EXPECT_TRUE(zoneMap.mayContainEqual("c"));
+    EXPECT_FALSE(zoneMap.mayContainEqual("e"));
+}
@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <numeric>
+#include <random>
 
 #include "common/constants.h"
 #include "common/exception/not_implemented.h"
@@ -10,7 +11,11 @@
 #include "common/serializer/serializer.h"
 #include "gmock/gmock-matchers.h"
 #include "gtest/gtest.h"
+#include "storage/compression/bitpacking_simd.h"
 #include "storage/compression/compression.h"
+#include "storage/compression/delta_compression.h"
+#include "storage/compression/fsst.h"
+#include "storage/compression/rle_compression.h"
 #include "storage/storage_utils.h"
 
 using namespace kuzu::common;
@@ -612,3 +617,325 @@ TEST(CompressionTests, OffsetIntegerPackingMultiPageSigned64) {
 
     integerPackingMultiPage(src);
 }
+
+/*
+ * Delta Compression Tests
+ */
+
+template<DeltaForType T>
+void deltaForMultiPage(const std::vector<T>& src) {
+    const auto& [min, max] = std::minmax_element(src.begin(), src.end());
+    auto forMetadata = CompressionMetadata(StorageValue(*min), StorageValue(*max),
+        CompressionType::INTEGER_BITPACKING);
+    auto metadata = DeltaForCompression<T>::analyze(src, forMetadata);
+    ASSERT_TRUE(metadata.has_value());
+    EXPECT_EQ(metadata->compression, CompressionType::DELTA_FOR);
+    EXPECT_GT(DeltaForCompression<T>::numValues(PAGE_SIZE, *metadata),
+        IntegerBitpacking<T>::numValues(PAGE_SIZE, forMetadata));
+
+    auto alg = DeltaForCompression<T>();
+    const auto numValuesPerPage = DeltaForCompression<T>::numValues(PAGE_SIZE, *metadata);
+    const auto numPages = src.size() / numValuesPerPage + (src.size() % numValuesPerPage != 0);
+    std::vector<uint8_t> dest(numPages * PAGE_SIZE);
+    const uint8_t* srcCursor = reinterpret_cast<const uint8_t*>(src.data());
+    for (auto i = 0u; i < numPages; i++) {
+        alg.compressNextPage(srcCursor, src.size() - i * numValuesPerPage,
+            dest.data() + i * PAGE_SIZE, PAGE_SIZE, *metadata);
+    }
+    std::vector<T> decompressed(src.size());
+    for (auto i = 0u; i < src.size(); i += numValuesPerPage) {
+        alg.decompressFromPage(dest.data() + i / numValuesPerPage * PAGE_SIZE, 0 /*srcOffset*/,
+            reinterpret_cast<uint8_t*>(decompressed.data()), i,
+            std::min<uint64_t>(numValuesPerPage, src.size() - i), *metadata);
+    }
+    EXPECT_EQ(decompressed, src);
+    // Random access to single values
+    for (auto i = 0u; i < src.size(); i += 37) {
+        T value = 0;
+        alg.decompressFromPage(dest.data() + i / numValuesPerPage * PAGE_SIZE,
+            i % numValuesPerPage, reinterpret_cast<uint8_t*>(&value), 0 /*dstOffset*/,
+            1 /*numValues*/, *metadata);
+        EXPECT_EQ(value, src[i]);
+    }
+    // Ranges which start in the middle of a block and span several blocks
+    constexpr auto blockSize = DeltaForCompression<T>::BLOCK_SIZE;
+    for (auto startInPage : {1ul, blockSize - 1, blockSize + 3}) {
+        for (auto numValues : {2ul, blockSize, 3 * blockSize + 5}) {
+            if (startInPage + numValues > std::min<uint64_t>(numValuesPerPage, src.size())) {
+                continue;
+            }
+            std::vector<T> range(numValues);
+            alg.decompressFromPage(dest.data(), startInPage,
+                reinterpret_cast<uint8_t*>(range.data()), 0 /*dstOffset*/, numValues, *metadata);
+            EXPECT_TRUE(std::equal(range.begin(), range.end(), src.begin() + startInPage));
+        }
+    }
+}
+
+TEST(CompressionTests, DeltaForMultiPageUnsigned64) {
+    std::vector<uint64_t> src(10000);
+    src[0] = 1000000;
+    for (auto i = 1u; i < src.size(); i++) {
+        src[i] = src[i - 1] + (i * 7) % 13;
+    }
+    deltaForMultiPage(src);
+}
+
+TEST(CompressionTests, DeltaForMultiPageSigned32) {
+    std::vector<int32_t> src(10000);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = -5000000 + static_cast<int32_t>(i) * 3 + static_cast<int32_t>(i % 2);
+    }
+    deltaForMultiPage(src);
+}
+
+TEST(CompressionTests, DeltaForConstantDelta) {
+    std::vector<int64_t> src(10000);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = 100 + static_cast<int64_t>(i) * 64;
+    }
+    deltaForMultiPage(src);
+}
+
+TEST(CompressionTests, DeltaForOnlyUsedForSortedValues) {
+    std::vector<uint32_t> src{1, 2, 3, 5, 4, 6};
+    const auto metadata = CompressionMetadata(StorageValue(1), StorageValue(6),
+        CompressionType::INTEGER_BITPACKING);
+    EXPECT_FALSE(DeltaForCompression<uint32_t>::analyze(src, metadata).has_value());
+    // Deltas need as many bits as the values themselves
+    std::vector<uint32_t> largeDeltas{0, 1, 2, 1000};
+    EXPECT_FALSE(DeltaForCompression<uint32_t>::analyze(largeDeltas,
+        CompressionMetadata(StorageValue(0), StorageValue(1000),
+            CompressionType::INTEGER_BITPACKING))
+                     .has_value());
+}
+
+/*
+ * FSST Tests
+ */
+
+std::string fsstRoundTrip(const FSSTSymbolTable& table, std::string_view str) {
+    std::vector<uint8_t> encoded(FSSTSymbolTable::getMaxEncodedLength(str.size()));
+    encoded.resize(table.encode(str, encoded.data()));
+    std::string decoded(table.getDecodedLength(encoded.data(), encoded.size()), '\0');
+    EXPECT_EQ(table.decode(encoded.data(), encoded.size(),
+                  reinterpret_cast<uint8_t*>(decoded.data())),
+        decoded.size());
+    return decoded;
+}
+
+TEST(CompressionTests, FSSTRoundTrip) {
+    std::vector<std::string> strings;
+    for (auto i = 0u; i < 1000; i++) {
+        strings.push_back("https://www.example.com/users/" + std::to_string(i) + "/profile");
+    }
+    const std::vector<std::string_view> sample(strings.begin(), strings.end());
+    const auto table = FSSTSymbolTable::train(sample);
+    EXPECT_GT(table.getNumSymbols(), 0);
+
+    uint64_t totalSize = 0, totalEncodedSize = 0;
+    for (const auto& str : strings) {
+        std::vector<uint8_t> encoded(FSSTSymbolTable::getMaxEncodedLength(str.size()));
+        totalEncodedSize += table.encode(str, encoded.data());
+        totalSize += str.size();
+        EXPECT_EQ(fsstRoundTrip(table, str), str);
+    }
+    EXPECT_LT(totalEncodedSize * 2, totalSize);
+    // Strings with bytes that never occurred in the sample are escaped
+    EXPECT_EQ(fsstRoundTrip(table, "\xff\xfe unseen bytes \x01"), "\xff\xfe unseen bytes \x01");
+    EXPECT_EQ(fsstRoundTrip(table, ""), "");
+}
+
+TEST(CompressionTests, FSSTEmptyTableEscapesEverything) {
+    const FSSTSymbolTable table;
+    std::string str = "abc";
+    std::vector<uint8_t> encoded(FSSTSymbolTable::getMaxEncodedLength(str.size()));
+    EXPECT_EQ(table.encode(str, encoded.data()), FSSTSymbolTable::getMaxEncodedLength(str.size()));
+    EXPECT_EQ(fsstRoundTrip(table, str), str);
+}
+
+TEST(CompressionTests, FSSTMetadataSerializeThenDeserialize) {
+    const std::vector<std::string_view> sample{"kuzu", "kuzudb", "graph database", "database"};
+    CompressionMetadata orig{StorageValue{0}, StorageValue{255}, CompressionType::FSST};
+    orig.extraMetadata = std::make_unique<FSSTMetadata>(
+        std::make_shared<const FSSTSymbolTable>(FSSTSymbolTable::train(sample)));
+
+    const auto writer = std::make_shared<BufferedSerializer>();
+    Serializer ser{writer};
+    orig.serialize(ser);
+    Deserializer deser{std::make_unique<BufferReader>(writer->getBlobData(), writer->getSize())};
+    const auto deserialized = CompressionMetadata::deserialize(deser);
+    ASSERT_EQ(deserialized.compression, CompressionType::FSST);
+    const auto& origTable = *orig.fsstMetadata()->symbolTable;
+    const auto& deserializedTable = *deserialized.fsstMetadata()->symbolTable;
+    EXPECT_EQ(origTable.getNumSymbols(), deserializedTable.getNumSymbols());
+    for (const auto str : sample) {
+        std::vector<uint8_t> encoded(FSSTSymbolTable::getMaxEncodedLength(str.size()));
+        encoded.resize(origTable.encode(str, encoded.data()));
+        std::string decoded(deserializedTable.getDecodedLength(encoded.data(), encoded.size()),
+            '\0');
+        deserializedTable.decode(encoded.data(), encoded.size(),
+            reinterpret_cast<uint8_t*>(decoded.data()));
+        EXPECT_EQ(decoded, str);
+    }
+}
+
+TEST(CompressionTests, RLERoundTrip) {
+    std::vector<int32_t> values(10000, 7);
+    std::fill(values.begin() + 100, values.begin() + 5000, -3);
+    std::fill(values.begin() + 9999, values.end(), 42);
+    const auto* data = reinterpret_cast<const uint8_t*>(values.data());
+    const auto metadata = RunLengthEncoding::analyze(data, values.size(), PhysicalTypeID::INT32,
+        StorageValue(-3), StorageValue(42));
+    ASSERT_TRUE(metadata.has_value());
+    ASSERT_EQ(metadata->compression, CompressionType::RLE);
+    EXPECT_THAT(metadata->rleMetadata()->runEnds, ::testing::ElementsAre(100, 5000, 9999, 10000));
+    EXPECT_EQ(metadata->numValues(PAGE_SIZE, PhysicalTypeID::INT32), UINT64_MAX);
+
+    const RunLengthEncoding alg{PhysicalTypeID::INT32};
+    std::vector<int32_t> result(values.size());
+    alg.decompressFromPage(nullptr, 0, reinterpret_cast<uint8_t*>(result.data()), 0,
+        values.size(), *metadata);
+    EXPECT_THAT(result, ::testing::ContainerEq(values));
+    // Ranges starting and ending within runs
+    std::fill(result.begin(), result.end(), 0);
+    alg.decompressFromPage(nullptr, 95, reinterpret_cast<uint8_t*>(result.data()), 3, 9905,
+        *metadata);
+    for (auto i = 0u; i < 9905; i++) {
+        ASSERT_EQ(result[i + 3], values[i + 95]) << i;
+    }
+}
+
+TEST(CompressionTests, RLEBooleansAreReadAsBits) {
+    // A mostly null column: a null mask with only a few non-null values
+    const uint64_t numValues = 2048;
+    std::vector<uint64_t> nullMask(numValues / 64, ~0ull);
+    NullMask::setNullRange(nullMask.data(), 1000, 3, false);
+    const auto metadata = RunLengthEncoding::analyze(reinterpret_cast<uint8_t*>(nullMask.data()),
+        numValues, PhysicalTypeID::BOOL, StorageValue(false), StorageValue(true));
+    ASSERT_TRUE(metadata.has_value());
+    EXPECT_EQ(metadata->rleMetadata()->runEnds.size(), 3);
+
+    const RunLengthEncoding alg{PhysicalTypeID::BOOL};
+    std::vector<uint64_t> bits(numValues / 64, 0);
+    alg.copyFromPage(nullptr, 0, reinterpret_cast<uint8_t*>(bits.data()), 0, numValues,
+        *metadata);
+    EXPECT_THAT(bits, ::testing::ContainerEq(nullMask));
+    std::vector<uint8_t> bools(numValues);
+    alg.decompressFromPage(nullptr, 0, bools.data(), 0, numValues, *metadata);
+    for (auto i = 0u; i < numValues; i++) {
+        ASSERT_EQ(static_cast<bool>(bools[i]), NullMask::isNull(nullMask.data(), i)) << i;
+    }
+}
+
+TEST(CompressionTests, RLEOnlyUsedForFewRuns) {
+    std::vector<uint8_t> values(1000);
+    for (auto i = 0u; i < values.size(); i++) {
+        values[i] = i / 10 % 2;
+    }
+    EXPECT_FALSE(RunLengthEncoding::analyze(values.data(), values.size(), PhysicalTypeID::UINT8,
+        StorageValue(0), StorageValue(1))
+                     .has_value());
+    values.resize(RunLengthEncoding::MAX_NUM_RUNS * 10);
+    EXPECT_TRUE(RunLengthEncoding::analyze(values.data(), values.size(), PhysicalTypeID::UINT8,
+        StorageValue(0), StorageValue(1))
+                    .has_value());
+}
+
+TEST(CompressionTests, RLEMetadataSerializeThenDeserialize) {
+    const std::vector<int64_t> values{5, 5, 5, -1, -1, 9};
+    const auto orig = RunLengthEncoding::analyze(reinterpret_cast<const uint8_t*>(values.data()),
+        values.size(), PhysicalTypeID::INT64, StorageValue(-1), StorageValue(9));
+    ASSERT_TRUE(orig.has_value());
+
+    const auto writer = std::make_shared<BufferedSerializer>();
+    Serializer ser{writer};
+    orig->serialize(ser);
+    Deserializer deser{std::make_unique<BufferReader>(writer->getBlobData(), writer->getSize())};
+    const auto deserialized = CompressionMetadata::deserialize(deser);
+    ASSERT_EQ(deserialized.compression, CompressionType::RLE);
+    EXPECT_EQ(deserialized.rleMetadata()->runEnds, orig->rleMetadata()->runEnds);
+    std::vector<int64_t> result(values.size());
+    RunLengthEncoding(PhysicalTypeID::INT64)
+        .decompressFromPage(nullptr, 0, reinterpret_cast<uint8_t*>(result.data()), 0,
+            values.size(), deserialized);
+    EXPECT_THAT(result, ::testing::ContainerEq(values));
+}
+
+template<SIMDUnpackType T>
+void testSIMDBitUnpacking(uint8_t bitWidth) {
+    // Enough chunks for the kernels' main loop as well as the padded tail
+    const uint64_t numChunks = 9;
+    std::mt19937_64 rng(bitWidth);
+    std::vector<T> values(numChunks * SIMDBitUnpacking::CHUNK_SIZE);
+    for (auto& value : values) {
+        value = rng() >> (64 - bitWidth);
+    }
+    // fastpfor packs 32 and 64-bit values into a continuous little-endian bit stream
+    std::vector<uint8_t> packed(numChunks * SIMDBitUnpacking::CHUNK_SIZE * bitWidth / 8);
+    for (auto i = 0u; i < values.size(); i++) {
+        for (auto bit = 0u; bit < bitWidth; bit++) {
+            const auto pos = i * bitWidth + bit;
+            packed[pos / 8] |= ((values[i] >> bit) & 1) << (pos % 8);
+        }
+    }
+    for (auto level :
+        {SIMDLevel::SCALAR, SIMDLevel::SSE4_1, SIMDLevel::AVX2, SIMDLevel::AVX512}) {
+        if (!SIMDBitUnpacking::isSupported(level)) {
+            continue;
+        }
+        std::vector<T> result(values.size());
+        SIMDBitUnpacking::unpack(packed.data(), result.data(), numChunks, bitWidth, level);
+        EXPECT_THAT(result, ::testing::ContainerEq(values))
+            << SIMDBitUnpacking::getLevelName(level) << " " << (int)bitWidth;
+    }
+}
+
+TEST(CompressionTests, SIMDBitUnpackingMatchesScalar) {
+    EXPECT_TRUE(SIMDBitUnpacking::isSupported(SIMDLevel::SCALAR));
+    for (uint8_t bitWidth = 1; bitWidth <= 32; bitWidth++) {
+        testSIMDBitUnpacking<uint32_t>(bitWidth);
+    }
+    for (uint8_t bitWidth = 1; bitWidth <= 64; bitWidth++) {
+        testSIMDBitUnpacking<uint64_t>(bitWidth);
+    }
+}
+
+template<typename T>
+void testBitpackingFilter(const std::vector<T>& src, T min, T max) {
+    const auto alg = IntegerBitpacking<T>();
+    const auto& [minValue, maxValue] = std::minmax_element(src.begin(), src.end());
+    const auto metadata = CompressionMetadata(StorageValue(*minValue), StorageValue(*maxValue),
+        CompressionType::INTEGER_BITPACKING);
+    std::vector<uint8_t> page(PAGE_SIZE);
+    const auto* srcCursor = reinterpret_cast<const uint8_t*>(src.data());
+    alg.compressNextPage(srcCursor, src.size(), page.data(), page.size(), metadata);
+    // Ranges which start and end within chunks, and which span several full chunks
+    for (const auto& [srcOffset, numValues] : std::vector<std::pair<uint64_t, uint64_t>>{
+             {0, src.size()}, {5, 20}, {7, src.size() - 7}, {32, 320}, {45, 401}}) {
+        std::vector<uint64_t> matches(DEFAULT_VECTOR_CAPACITY / 64);
+        alg.filterFromPage(page.data(), srcOffset, matches.data(), 3, numValues, metadata, min,
+            max);
+        for (auto i = 0u; i < numValues; i++) {
+            const auto value = src[srcOffset + i];
+            ASSERT_EQ(NullMask::isNull(matches.data(), 3 + i), value >= min && value <= max)
+                << srcOffset << " " << i;
+        }
+    }
+}
+
+TEST(CompressionTests, IntegerBitpackingFilter) {
+    std::vector<int32_t> frameOfReference(1000);
+    std::vector<int64_t> negative(1000);
+    std::vector<uint16_t> unsignedValues(1000);
+    for (auto i = 0u; i < 1000; i++) {
+        frameOfReference[i] = 100000 + (i * 37) % 500;
+        negative[i] = static_cast<int64_t>((i * 7919) % 2000) - 1000;
+        unsignedValues[i] = (i * 13) % 4000;
+    }
+    testBitpackingFilter<int32_t>(frameOfReference, 100100, 100200);
+    testBitpackingFilter<int32_t>(frameOfReference, INT32_MIN, 100000);
+    testBitpackingFilter<int32_t>(frameOfReference, 0, 99999);
+    testBitpackingFilter<int64_t>(negative, -10, 500);
+    testBitpackingFilter<uint16_t>(unsignedValues, 2000, UINT16_MAX);
+}
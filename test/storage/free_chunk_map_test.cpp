@@ -0,0 +1,170 @@
+#include <cstring>
+
+#include "common/serializer/buffered_serializer.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/reader.h"
+#include "common/serializer/serializer.h"
+#include "gtest/gtest.h"
+#include "storage/store/free_chunk_map.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace {
+
+struct FreeChunkMapBufferReader : Reader {
+    FreeChunkMapBufferReader(uint8_t* data, size_t dataSize)
+        : data(data), dataSize(dataSize), readSize(0) {}
+
+    void read(uint8_t* outputData, uint64_t size) final {
+        memcpy(outputData, data + readSize, size);
+        readSize += size;
+    }
+
+    bool finished() final { return (readSize >= dataSize); }
+
+    uint8_t* data;
+    size_t dataSize;
+    size_t readSize;
+};
+
+void checkFreeChunks(const FreeChunkMap& freeChunkMap,
+    const std::vector<std::pair<page_idx_t, page_idx_t>>& expected) {
+    const auto freeChunks = freeChunkMap.getFreeChunks();
+    ASSERT_EQ(freeChunks.size(), expected.size());
+    for (auto i = 0u; i < expected.size(); i++) {
+        EXPECT_EQ(freeChunks[i].pageIdx, expected[i].first);
+        EXPECT_EQ(freeChunks[i].numPages, expected[i].second);
+    }
+}
+
+} // namespace
+
+TEST(FreeChunkMapTests, CoalesceAdjacentChunks) {
+    FreeChunkMap freeChunkMap;
+    freeChunkMap.addFreeChunk(10, 5);
+    freeChunkMap.addFreeChunk(20, 5);
+    freeChunkMap.releasePendingFreeChunks();
+    checkFreeChunks(freeChunkMap, {{10, 5}, {20, 5}});
+    // Fills the gap in between, so all three chunks become one extent.
+    freeChunkMap.addFreeChunk(15, 5);
+    freeChunkMap.releasePendingFreeChunks();
+    checkFreeChunks(freeChunkMap, {{10, 15}});
+    freeChunkMap.addFreeChunk(5, 5);
+    freeChunkMap.addFreeChunk(25, 1);
+    freeChunkMap.releasePendingFreeChunks();
+    checkFreeChunks(freeChunkMap, {{5, 21}});
+    const auto stats = freeChunkMap.getStats();
+    EXPECT_EQ(stats.numFreeChunks, 1);
+    EXPECT_EQ(stats.numFreePages, 21);
+    EXPECT_EQ(stats.largestFreeChunk, 21);
+    EXPECT_DOUBLE_EQ(stats.fragmentation, 0);
+}
+
+TEST(FreeChunkMapTests, BestFitAllocation) {
+    FreeChunkMap freeChunkMap;
+    freeChunkMap.addFreeChunk(0, 8);
+    freeChunkMap.addFreeChunk(100, 3);
+    freeChunkMap.addFreeChunk(200, 4);
+    freeChunkMap.releasePendingFreeChunks();
+    // The smallest extent that fits 3 pages is [100, 103).
+    auto entry = freeChunkMap.getFreeChunk(3);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->pageIdx, 100);
+    EXPECT_EQ(entry->numPages, 3);
+    // Only the 4-page extent and the 8-page extent fit, and the 4-page one is split.
+    entry = freeChunkMap.getFreeChunk(2);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->pageIdx, 200);
+    EXPECT_EQ(entry->numPages, 2);
+    checkFreeChunks(freeChunkMap, {{0, 8}, {202, 2}});
+    EXPECT_EQ(freeChunkMap.getFreeChunk(9), nullptr);
+    const auto stats = freeChunkMap.getStats();
+    EXPECT_EQ(stats.numReusedPages, 5);
+    EXPECT_EQ(stats.numFreePages, 10);
+    EXPECT_DOUBLE_EQ(stats.fragmentation, 0.2);
+}
+
+TEST(FreeChunkMapTests, SerializeThenDeserialize) {
+    FreeChunkMap freeChunkMap{FreeChunkPolicy::FIRST_FIT};
+    freeChunkMap.addFreeChunk(3, 1);
+    freeChunkMap.addFreeChunk(7, 10);
+    freeChunkMap.releasePendingFreeChunks();
+    // Pending chunks are persisted as free ones.
+    freeChunkMap.addFreeChunk(40, 2);
+    const auto writer = std::make_shared<BufferedSerializer>();
+    Serializer ser{writer};
+    freeChunkMap.serialize(ser);
+
+    Deserializer deser{std::make_unique<FreeChunkMapBufferReader>(writer->getBlobData(),
+        writer->getSize())};
+    FreeChunkMap deserialized;
+    deserialized.deserialize(deser);
+    checkFreeChunks(deserialized, {{3, 1}, {7, 10}, {40, 2}});
+    EXPECT_EQ(deserialized.getPolicy(), FreeChunkPolicy::FIRST_FIT);
+    // The size index must be rebuilt as well.
+    deserialized.setPolicy(FreeChunkPolicy::BEST_FIT);
+    auto entry = deserialized.getFreeChunk(2);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->pageIdx, 40);
+}
+
+TEST(FreeChunkMapTests, PendingChunksAreNotReusedBeforeRelease) {
+    FreeChunkMap freeChunkMap;
+    freeChunkMap.addFreeChunk(0, 4);
+    EXPECT_EQ(freeChunkMap.getFreeChunk(1), nullptr);
+    EXPECT_EQ(freeChunkMap.getStats().numFreePages, 0);
+    freeChunkMap.releasePendingFreeChunks();
+    EXPECT_NE(freeChunkMap.getFreeChunk(1), nullptr);
+}
+
+TEST(FreeChunkMapTests, RemoveTailFreeChunk) {
+    FreeChunkMap freeChunkMap;
+    freeChunkMap.addFreeChunk(2, 3);
+    freeChunkMap.addFreeChunk(10, 6);
+    freeChunkMap.releasePendingFreeChunks();
+    // The file has pages beyond the last free extent, so nothing can be truncated.
+    EXPECT_EQ(freeChunkMap.removeTailFreeChunk(20), 20);
+    EXPECT_EQ(freeChunkMap.removeTailFreeChunk(16), 10);
+    checkFreeChunks(freeChunkMap, {{2, 3}});
+    // Only extents before the first candidate page are kept when searching with an upper bound.
+    EXPECT_EQ(freeChunkMap.getFreeChunk(2, 2 /* maxPageIdx */), nullptr);
+    EXPECT_NE(freeChunkMap.getFreeChunk(2, 3 /* maxPageIdx */), nullptr);
+    freeChunkMap.removeFreeChunksBeyond(3);
+    checkFreeChunks(freeChunkMap, {});
+}
+
+TEST(FreeChunkMapTests, FirstFitAllocation) {
+    FreeChunkMap freeChunkMap{FreeChunkPolicy::FIRST_FIT};
+    freeChunkMap.addFreeChunk(0, 8);
+    freeChunkMap.addFreeChunk(100, 3);
+    freeChunkMap.releasePendingFreeChunks();
+    // Unlike best-fit, the extent with the lowest start page is split.
+    auto entry = freeChunkMap.getFreeChunk(3);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->pageIdx, 0);
+    checkFreeChunks(freeChunkMap, {{3, 5}, {100, 3}});
+    entry = freeChunkMap.getFreeChunk(6);
+    EXPECT_EQ(entry, nullptr);
+    const auto stats = freeChunkMap.getStats();
+    EXPECT_EQ(stats.policy, FreeChunkPolicy::FIRST_FIT);
+    uint64_t numAllocations = 0;
+    for (const auto numAllocationsInBucket : stats.allocationLatencyHistogram) {
+        numAllocations += numAllocationsInBucket;
+    }
+    EXPECT_EQ(numAllocations, 2);
+}
+
+TEST(FreeChunkMapTests, AppendOnlyNeverReusesPages) {
+    FreeChunkMap freeChunkMap{FreeChunkPolicy::APPEND_ONLY};
+    freeChunkMap.addFreeChunk(0, 8);
+    freeChunkMap.releasePendingFreeChunks();
+    EXPECT_EQ(freeChunkMap.getFreeChunk(1), nullptr);
+    freeChunkMap.recordAppendedPages(4);
+    // Freed pages are still tracked, so they can be reused after switching the policy.
+    freeChunkMap.setPolicy(FreeChunkPolicy::BEST_FIT);
+    EXPECT_NE(freeChunkMap.getFreeChunk(1), nullptr);
+    const auto stats = freeChunkMap.getStats();
+    EXPECT_EQ(stats.numAppendedPages, 4);
+    EXPECT_EQ(stats.numReusedPages, 1);
+}
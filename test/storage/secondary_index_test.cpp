@@ -0,0 +1,66 @@
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/index_catalog_entry.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "graph_test/graph_test.h"
+#include "storage/index/secondary_index.h"
+#include "storage/storage_manager.h"
+#include "storage/store/node_table.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace testing {
+
+class SecondaryIndexTest : public EmptyDBTest {
+protected:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        createDBAndConn();
+    }
+
+public:
+    uint64_t getNumIndexEntries(const std::string& tableName, const std::string& indexName) {
+        auto* catalog = database->getCatalog();
+        auto* transaction = &transaction::DUMMY_CHECKPOINT_TRANSACTION;
+        const auto tableID = catalog->getTableCatalogEntry(transaction, tableName)->getTableID();
+        const auto indexID = catalog->getIndexCatalogEntry(transaction, indexName)->getOID();
+        auto& table = getStorageManager(*database)->getTable(tableID)->cast<NodeTable>();
+        return table.getSecondaryIndex(indexID)->getNumEntries();
+    }
+};
+
+TEST_F(SecondaryIndexTest, CheckpointDropsDeadEntries) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    ASSERT_TRUE(conn->query("CALL auto_checkpoint=false")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE person(id INT64, name STRING, PRIMARY KEY(id))")
+                    ->isSuccess());
+    ASSERT_TRUE(conn->query("UNWIND range(0, 2999) AS i CREATE (:person {id: i, name: 'p' + "
+                            "cast(i % 10, 'STRING')})")
+                    ->isSuccess());
+    ASSERT_TRUE(conn->query("CALL CREATE_INDEX('person_name', 'person', 'name') RETURN *")
+                    ->isSuccess());
+    ASSERT_TRUE(conn->query("CHECKPOINT")->isSuccess());
+    ASSERT_EQ(getNumIndexEntries("person", "person_name"), 3000);
+    // Updated values are indexed in addition to the old ones until the next checkpoint.
+    ASSERT_TRUE(
+        conn->query("MATCH (p:person) WHERE p.id < 100 SET p.name = 'changed'")->isSuccess());
+    ASSERT_EQ(getNumIndexEntries("person", "person_name"), 3100);
+    // The new entries are merged on their own, so the old values stay in the large run.
+    ASSERT_TRUE(conn->query("CHECKPOINT")->isSuccess());
+    ASSERT_EQ(getNumIndexEntries("person", "person_name"), 3100);
+    // Once most entries are dead, all runs are rewritten without them.
+    ASSERT_TRUE(conn->query("MATCH (p:person) WHERE p.id >= 1000 DELETE p")->isSuccess());
+    ASSERT_TRUE(conn->query("CHECKPOINT")->isSuccess());
+    ASSERT_EQ(getNumIndexEntries("person", "person_name"), 1000);
+    auto result = conn->query("MATCH (p:person) WHERE p.name = 'changed' RETURN count(*)");
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 100);
+    result = conn->query("MATCH (p:person) WHERE p.name = 'p3' RETURN count(*)");
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 90);
+}
+
+} // namespace testing
+} // namespace kuzu
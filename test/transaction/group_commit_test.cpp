@@ -0,0 +1,84 @@
+#include <thread>
+
+#include "graph_test/graph_test.h"
+
+namespace kuzu {
+namespace testing {
+
+class GroupCommitTest : public EmptyDBTest {
+protected:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        createDBAndConn();
+    }
+
+    void TearDown() override { EmptyDBTest::TearDown(); }
+
+public:
+    int64_t getWALInfo(const std::string& columnName) {
+        return conn->query("CALL wal_info() RETURN " + columnName)
+            ->getNext()
+            ->getValue(0)
+            ->getValue<int64_t>();
+    }
+};
+
+// Commits of one connection can only be grouped with commits of other connections, as a connection
+// waits until its commit is durable before running the next statement.
+TEST_F(GroupCommitTest, ConcurrentCommitsShareSyncs) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    ASSERT_TRUE(conn->query("CALL auto_checkpoint=false")->isSuccess());
+    ASSERT_TRUE(conn->query("CALL force_checkpoint_on_close=false")->isSuccess());
+    ASSERT_TRUE(conn->query("CALL group_commit_max_delay=20000")->isSuccess());
+    ASSERT_TRUE(
+        conn->query("CREATE NODE TABLE person(ID INT64, PRIMARY KEY(ID))")->isSuccess());
+    const auto numSyncedCommitsBefore = getWALInfo("num_synced_commits");
+    constexpr int64_t numThreads = 4;
+    constexpr int64_t numCommitsPerThread = 25;
+    std::vector<std::unique_ptr<main::Connection>> conns;
+    for (auto i = 0; i < numThreads; i++) {
+        conns.push_back(std::make_unique<main::Connection>(database.get()));
+    }
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < numThreads; i++) {
+        threads.emplace_back([&, i]() {
+            for (auto j = 0; j < numCommitsPerThread; j++) {
+                const auto id = i * numCommitsPerThread + j;
+                // Only one write transaction can be active at a time, so retry until this one
+                // gets its turn.
+                while (true) {
+                    auto result =
+                        conns[i]->query("CREATE (:person {ID: " + std::to_string(id) + "})");
+                    if (result->isSuccess()) {
+                        break;
+                    }
+                    const auto errorMessage = result->getErrorMessage();
+                    EXPECT_NE(errorMessage.find("Cannot start a new write transaction"),
+                        std::string::npos)
+                        << errorMessage;
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    constexpr auto numCommits = numThreads * numCommitsPerThread;
+    ASSERT_EQ(getWALInfo("num_synced_commits") - numSyncedCommitsBefore, numCommits);
+    ASSERT_GT(getWALInfo("max_batch_size"), 1);
+    ASSERT_LT(getWALInfo("num_syncs"), getWALInfo("num_synced_commits"));
+    // The commits are only in the WAL, so they are replayed when the database is reopened.
+    conns.clear();
+    conn.reset();
+    createDBAndConn();
+    auto result = conn->query("MATCH (p:person) RETURN count(*), sum(p.ID)");
+    auto tuple = result->getNext();
+    ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), numCommits);
+    ASSERT_EQ(tuple->getValue(1)->getValue<int64_t>(), numCommits * (numCommits - 1) / 2);
+}
+
+} // namespace testing
+} // namespace kuzu
@@ -0,0 +1,86 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "storage/compression/bitpacking_simd.h"
+
+using namespace kuzu::storage;
+
+// Measures the bit-unpacking throughput of each SIMD level supported by this CPU, for every bit
+// width of 32 and 64-bit values. Prints the best time per value out of --run repetitions of
+// unpacking --chunks chunks of 32 values.
+
+struct BitpackingBenchmarkConfig {
+    uint64_t numRuns = 20;
+    uint64_t numChunks = 2048;
+};
+
+static std::vector<uint8_t> packValues(uint64_t numValues, uint8_t bitWidth) {
+    std::mt19937_64 rng(bitWidth);
+    std::vector<uint8_t> packed(numValues * bitWidth / 8);
+    for (auto i = 0u; i < numValues; i++) {
+        const auto value = rng() >> (64 - bitWidth);
+        for (auto bit = 0u; bit < bitWidth; bit++) {
+            const auto pos = i * bitWidth + bit;
+            packed[pos / 8] |= ((value >> bit) & 1) << (pos % 8);
+        }
+    }
+    return packed;
+}
+
+template<SIMDUnpackType T>
+static double timeUnpacking(const std::vector<uint8_t>& packed, uint8_t bitWidth,
+    SIMDLevel level, const BitpackingBenchmarkConfig& config) {
+    std::vector<T> result(config.numChunks * SIMDBitUnpacking::CHUNK_SIZE);
+    auto best = std::chrono::nanoseconds::max();
+    for (auto run = 0u; run < config.numRuns; run++) {
+        const auto start = std::chrono::steady_clock::now();
+        SIMDBitUnpacking::unpack(packed.data(), result.data(), config.numChunks, bitWidth, level);
+        const auto end = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start));
+    }
+    return static_cast<double>(best.count()) / static_cast<double>(result.size());
+}
+
+template<SIMDUnpackType T>
+static void runBenchmarks(const BitpackingBenchmarkConfig& config) {
+    for (uint8_t bitWidth = 1; bitWidth <= sizeof(T) * 8; bitWidth++) {
+        const auto packed = packValues(config.numChunks * SIMDBitUnpacking::CHUNK_SIZE, bitWidth);
+        const auto scalar = timeUnpacking<T>(packed, bitWidth, SIMDLevel::SCALAR, config);
+        for (auto level :
+            {SIMDLevel::SCALAR, SIMDLevel::SSE4_1, SIMDLevel::AVX2, SIMDLevel::AVX512}) {
+            if (!SIMDBitUnpacking::isSupported(level)) {
+                continue;
+            }
+            const auto nsPerValue = level == SIMDLevel::SCALAR ?
+                                        scalar :
+                                        timeUnpacking<T>(packed, bitWidth, level, config);
+            printf("unpack<uint%zu_t>/%u/%-8s %10.3f ns/value %8.2fx\n", sizeof(T) * 8,
+                bitWidth, std::string(SIMDBitUnpacking::getLevelName(level)).c_str(), nsPerValue,
+                scalar / nsPerValue);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    BitpackingBenchmarkConfig config;
+    for (auto i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.starts_with("--run=")) {
+            config.numRuns = std::stoull(arg.substr(6));
+        } else if (arg.starts_with("--chunks=")) {
+            config.numChunks = std::stoull(arg.substr(9));
+        } else {
+            printf("Unrecognized option %s\n", arg.c_str());
+            return 1;
+        }
+    }
+    printf("Supported SIMD level: %s\n",
+        std::string(SIMDBitUnpacking::getLevelName(SIMDBitUnpacking::getSupportedLevel())).c_str());
+    runBenchmarks<uint32_t>(config);
+    runBenchmarks<uint64_t>(config);
+    return 0;
+}
@@ -0,0 +1,102 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/enums/numa_policy.h"
+#include "storage/buffer_manager/vm_region.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+// Measures how the backing of a buffer manager VMRegion affects memory access latency. For each
+// combination of huge pages and NUMA policy, touches every frame of a --size MB region once, then
+// chases pointers through the frames in random order, so nearly every access misses the TLB (and,
+// with interleaving on a multi-node machine, often goes to a remote node). Prints the time to
+// fault in the region and the best time per access out of --run repetitions of --accesses reads.
+
+struct VMRegionBenchmarkConfig {
+    uint64_t numRuns = 5;
+    uint64_t regionSizeInMB = 1024;
+    uint64_t numAccesses = 1 << 22;
+};
+
+static std::string getPolicyName(NumaPolicy numaPolicy) {
+    switch (numaPolicy) {
+    case NumaPolicy::INTERLEAVE:
+        return "interleave";
+    case NumaPolicy::LOCAL:
+        return "local";
+    default:
+        return "default";
+    }
+}
+
+// Each frame stores the index of the next frame to visit. The word is placed at a different
+// offset in each frame, so the chased words do not all map to the same cache sets.
+static uint64_t* getNextFrameSlot(const VMRegion& region, uint64_t frameIdx) {
+    constexpr uint64_t cacheLineSize = 64;
+    const auto offset = (frameIdx * cacheLineSize) % PAGE_SIZE;
+    return reinterpret_cast<uint64_t*>(region.getFrame(frameIdx) + offset);
+}
+
+static volatile uint64_t lastFrameIdx = 0;
+
+static void runBenchmark(bool useHugePages, NumaPolicy numaPolicy,
+    const VMRegionBenchmarkConfig& config) {
+    const auto regionSize = config.regionSizeInMB << 20;
+    VMRegion region(REGULAR_PAGE, regionSize, useHugePages, numaPolicy);
+    const auto numFrames = regionSize / PAGE_SIZE;
+    std::vector<uint64_t> order(numFrames);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin() + 1, order.end(), std::mt19937_64(numFrames));
+    const auto faultStart = std::chrono::steady_clock::now();
+    for (auto i = 0u; i < numFrames; i++) {
+        *getNextFrameSlot(region, order[i]) = order[(i + 1) % numFrames];
+    }
+    const auto faultEnd = std::chrono::steady_clock::now();
+    auto best = std::chrono::nanoseconds::max();
+    uint64_t frameIdx = 0;
+    for (auto run = 0u; run < config.numRuns; run++) {
+        const auto start = std::chrono::steady_clock::now();
+        for (auto i = 0u; i < config.numAccesses; i++) {
+            frameIdx = *getNextFrameSlot(region, frameIdx);
+        }
+        const auto end = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start));
+    }
+    // Storing the last frame keeps the compiler from removing the chase.
+    lastFrameIdx = frameIdx;
+    printf("hugePages=%-3s (%s) numa=%-10s (%s) fault-in %8.1f ms %8.2f ns/access\n",
+        useHugePages ? "on" : "off", region.isHugePageBacked() ? "backed" : "not backed",
+        getPolicyName(numaPolicy).c_str(),
+        region.hasNumaPolicyApplied() ? "applied" : "not applied",
+        std::chrono::duration<double, std::milli>(faultEnd - faultStart).count(),
+        static_cast<double>(best.count()) / static_cast<double>(config.numAccesses));
+}
+
+int main(int argc, char** argv) {
+    VMRegionBenchmarkConfig config;
+    for (auto i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.starts_with("--run=")) {
+            config.numRuns = std::stoull(arg.substr(6));
+        } else if (arg.starts_with("--size=")) {
+            config.regionSizeInMB = std::stoull(arg.substr(7));
+        } else if (arg.starts_with("--accesses=")) {
+            config.numAccesses = std::stoull(arg.substr(11));
+        } else {
+            printf("Unrecognized option %s\n", arg.c_str());
+            return 1;
+        }
+    }
+    for (auto useHugePages : {false, true}) {
+        for (auto numaPolicy : {NumaPolicy::DEFAULT, NumaPolicy::INTERLEAVE, NumaPolicy::LOCAL}) {
+            runBenchmark(useHugePages, numaPolicy, config);
+        }
+    }
+    return 0;
+}